@@ -15,21 +15,32 @@ inline uint256 _negmod(const uint256 &x, const uint256 &n) { return n - x; }
 
 inline uint256 _mulmod(const uint256 &x, const uint256 &y, const uint256 &n) { return intx::mulmod(x, y, n); }
 
-// Extended euclidean algorithm to find modular inverses for integers.
+// Binary extended euclidean algorithm to find modular inverses for integers. N must be odd. It only needs shifts,
+// additions and subtractions, there is no 256-bit division in the loop.
 // The return value INV_X satisfies: (X * INV_X) % N = 1
 inline uint256 _invmod(const uint256 &x, const uint256 &n) {
-  uint256 lm = 1, hm = 0;
-  uint256 lo = x % n, hi = n;
-  while (lo > 1) {
-    uint256 r = hi / lo;
-    uint256 nm = _submod(hm, _mulmod(lm, r, n), n);
-    uint256 nw = hi - lo * r;
-    hm = lm;
-    lm = nm;
-    hi = lo;
-    lo = nw;
+  // Invariant: a = u * x % n, b = v * x % n.
+  uint256 a = x % n, b = n;
+  uint256 u = 1, v = 0;
+  uint256 half_n = (n >> 1) + 1;
+  while (a != 0) {
+    if ((a & 1) == 0) {
+      a >>= 1;
+      u = (u & 1) == 0 ? u >> 1 : (u >> 1) + half_n;
+      continue;
+    }
+    if (a < b) {
+      uint256 t = a;
+      a = b;
+      b = t;
+      t = u;
+      u = v;
+      v = t;
+    }
+    a -= b;
+    u = _submod(u, v, n);
   }
-  return lm % n;
+  return v;
 }
 
 inline uint256 _divmod(const uint256 &x, const uint256 &y, const uint256 &n) { return _mulmod(x, _invmod(y, n), n); }
@@ -0,0 +1,5398 @@
+// Generated by script/gen_tables.sh, do not edit.
+//
+// The points of FixedBaseTable<G1>(G1_ONE) and FixedBaseTable<G2>(G2_ONE) in Montgomery form, x then y,
+// with four 64-bit limbs per FQ from the lowest.
+#ifndef BN128_MONT_TABLES_H_
+#define BN128_MONT_TABLES_H_
+
+#include <cstdint>
+
+namespace bn128 {
+
+// clang-format off
+constexpr uint64_t G1_ONE_TABLE_LIMBS[64][8][8] = {
+  {
+    {
+      0xd35d438dc58f0d9d, 0x0a78eb28f5c70b3d, 0x666ea36f7879462c, 0x0e0a77c19a07df2f,
+      0xa6ba871b8b1e1b3a, 0x14f1d651eb8e167b, 0xccdd46def0f28c58, 0x1c14ef83340fbe5e,
+    },
+    {
+      0xe10460b6c3e7ea38, 0xbc0b548b438e5469, 0xc2822db40c0ac2ec, 0x13227397098d014d,
+      0x3c208c16d87cfd47, 0x97816a916871ca8d, 0xb85045b68181585d, 0x04644e72e131a029,
+    },
+    {
+      0x9d831b4e248b11a0, 0x91f18c0677f54b7e, 0x0ee5ea95bfda15d0, 0x10f0baf628c70539,
+      0xbe1523ea983653ea, 0xe86e48177c629a1a, 0x51cc9f8e6d2a214a, 0x014925f0ca757913,
+    },
+    {
+      0x5febee1971564d86, 0x58acacf148120e83, 0xca2c0c38ea1d74aa, 0x26447b1b7818ff2d,
+      0xdc555f35d28ad82e, 0xe63965132b81a952, 0x68817cc19161afae, 0x2a9a7eac6627e4e0,
+    },
+    {
+      0x52bf458e0f922f69, 0x0d446cb51c4469e7, 0x8cbc7ee9edcd2d63, 0x2b4e5e7aa60ac63c,
+      0xf8dc7b28f7ed8001, 0x8dac7c4f75cd7ee8, 0xffbd01f419a6cd12, 0x1617a2c926a7c4dd,
+    },
+    {
+      0xceac0b66723d6a33, 0xcbe52396f29f405a, 0x1661ff1a6db1d8fb, 0x1e50f0ceae7de87c,
+      0x406e2f4a884100cd, 0xca5490bb970c83fc, 0x55bcb696508a249c, 0x12d223135c0250a1,
+    },
+    {
+      0x882e46ac94f0ffe6, 0xd02031eb693b6115, 0xc4b973707cd0a083, 0x101a055a2a8b2ebd,
+      0x44ec06f19f1f130f, 0x0aaade75c49fbc8c, 0x83fe42fd298fbecc, 0x1c91e3d299e23d8c,
+    },
+    {
+      0xf9773ef6092c76a7, 0x97e50275e6a0d3ba, 0xc9620be71103b1cd, 0x297daf4538ce11ae,
+      0x2f382df5c84afd58, 0x5440c88a168fcd50, 0xfa0c44a2deb0bbc4, 0x13fb82d846750cb1,
+    },
+  },
+  {
+    {
+      0xca91e10646737011, 0xb959d2974f5eca0b, 0x74a482152b77c60b, 0x0469309f76f5a438,
+      0x5958b2d6e1aaea6b, 0x33ec24b4cd9cccd8, 0x9299749ec9f94f31, 0x0a07d32f857fe2b9,
+    },
+    {
+      0x8af67d27f3b78c44, 0xcdc6bc780de8f49b, 0x6653f8851756e323, 0x24cfeb91f97ec8c2,
+      0xe5702b92c3746a8f, 0xc6971fc8b159d02f, 0x795ea19f4259e212, 0x04bf0e2944890515,
+    },
+    {
+      0xc3634dc97d3ab086, 0x2e5ea4554b30c778, 0xe13f2d35f54d9348, 0x2ee950e34c724715,
+      0x9433bda120c8045a, 0x18f7141fbe819fd3, 0x80cea0879c4e253e, 0x2f024f973202ef89,
+    },
+    {
+      0x2ab4ca698e6ea49e, 0xfdc1925a55cd8a9b, 0x9e6332e32becc80e, 0x0597108e3ba215ce,
+      0x9c68df2d7e5f17cf, 0x843cd091b550608a, 0x290be09c7178692a, 0x0bddf05a022ae74e,
+    },
+    {
+      0x78007378d472ef48, 0xb0eba9b26a05dbf0, 0x344be60b81c1b37c, 0x0b61055c6a1ba55a,
+      0xce9e20a8e4c94e19, 0x15aa2fe2deb4a8c7, 0x8c4624b98b3972cf, 0x1dcd14e30778ba54,
+    },
+    {
+      0xcc9104e70bc3975c, 0x1002eea813389a39, 0xa35e280ddec8cf78, 0x07f833b2054a5364,
+      0x8de10ca2d3337a63, 0xfeeaafd7b410a518, 0x29cb538d8d51af8f, 0x2f0957b28431a11e,
+    },
+    {
+      0xdb379720dd9d7a0e, 0x568b96e1cb1a2653, 0x5704318e34582a77, 0x1991ae9d06ba8203,
+      0x48989632cd1b0b5d, 0x2192186e7fb22c81, 0x0dae5fed460e1031, 0x2e88d9aad57ed737,
+    },
+    {
+      0x548f55c0acbc417c, 0x37d6c0039e8674b9, 0xd95144f959549345, 0x1d79f28dceddac28,
+      0x1734850514d5403f, 0xe3f938ccba97467f, 0x342703a062f29c34, 0x155451eb50ae8755,
+    },
+  },
+  {
+    {
+      0xa2b18a28aabc743b, 0xd8342193c4ab5364, 0x64a01e802c4e75ae, 0x0c5104d2913a8d72,
+      0x04b277cfde8d204a, 0xeadad937e285069d, 0x31a5256badeed9e1, 0x21b4a6603647c0fa,
+    },
+    {
+      0x9b9d4b6568ea1e19, 0xc0ce520fa068f111, 0x3828de470474df00, 0x2cf9e5ba718642bb,
+      0x4d2066ae44798d4d, 0x6ae9a02f3a030dba, 0x024ebe13acfeb940, 0x2300f0a53a387de7,
+    },
+    {
+      0x97d27db715a0153f, 0x2353894678257ae5, 0xcb843cb9ba916b85, 0x24067a9c02f18235,
+      0x84f00af76f96570e, 0x1b762f3ead04bcaf, 0x9da12c97414266c4, 0x273087a18501806a,
+    },
+    {
+      0xd7c0c766f292d78a, 0xe26a7a40a84fc9ac, 0xffd9104cd1729a4d, 0x07e30c416de29049,
+      0xea41a4e294827328, 0x9033ec5a14a4ec0d, 0xb18f4645f6289b5b, 0x0ce390715fc73824,
+    },
+    {
+      0x6bad89c9a858e7ef, 0xe87f3f50f6a177d2, 0x9f330bc1a4ee6236, 0x224b0a4d9bc357a0,
+      0xda108fc6cf76eca2, 0x124aed246cf08df9, 0x2fc9b4b6463e3fc5, 0x07cfde5884067255,
+    },
+    {
+      0x3d71636260717eb4, 0x252b3ad594f0480a, 0x0410c97890db235a, 0x1d12d378c025324a,
+      0xfda5a578f2739897, 0x396630effc5c5ecc, 0xe732b5a4d1df2492, 0x096a94f9db1b3291,
+    },
+    {
+      0xa8f60c062982b6c8, 0x442da74abd070553, 0x74adfbf0359268c7, 0x25a28774f4c785c9,
+      0xc747b4d0de4abd97, 0xfc69df0d4a461841, 0x5d71e8550fdcba54, 0x2feb227390249f04,
+    },
+    {
+      0x0d0bd5c17919b8e5, 0xbeecee37e9506cf1, 0xb74ec67e0ebf1957, 0x07a638b079d1bd48,
+      0x9ea49223658fe1fd, 0x4cfd033bd661f171, 0x700a3cd0f6a21bef, 0x1dddcc7814cb6e25,
+    },
+  },
+  {
+    {
+      0x729f0e82ea24a425, 0xf2cee3d33240345e, 0x1bd9b52f3b19f485, 0x1b08dbb4816f8f51,
+      0xb600825e98d6350e, 0xcbd19da84c992ce5, 0x8d01fe39893d1504, 0x1e2ba785c54dedf4,
+    },
+    {
+      0x04ca309e54db381d, 0x3a541d3b12aabc5f, 0xd79829dba8e241e7, 0x191548b186a8d623,
+      0xeb94a4a1b2f915b6, 0x42a58e6f6dd2a396, 0x53d63bf7ed6f678e, 0x11dce12d494d6254,
+    },
+    {
+      0x8d222218317eaaa5, 0x295aead6be0ac10b, 0x6ab0a6a0834cd5ae, 0x05af40b925116fe1,
+      0x5615b2975668b134, 0x80898de2b2770aec, 0x5bc8ce4373623181, 0x1f05f575ba569301,
+    },
+    {
+      0xcd95388af08789a9, 0xb032ceb8a70a3c99, 0x749263ce5acbf2e5, 0x28164e28dfcfd032,
+      0xee6a72cd125f8baa, 0x1d48bf1b2fde6b92, 0x9becc9bb334661a2, 0x28e8205bcbc4c311,
+    },
+    {
+      0x4381b8ccd6e10466, 0xb24789d44c3665e1, 0x47bf887b33c8864f, 0x25eb15e74be144f2,
+      0x9c3e5772be737206, 0x406d23b4d4acdeca, 0x7161860b85465e9d, 0x1678b7f68b9d697c,
+    },
+    {
+      0x468640e9e5acb4da, 0x926db579748d57d8, 0xbd5ad435ba8de63a, 0x2242a7ea0800ebb7,
+      0x20f2eb5c549bfc9c, 0xfca5289675e3bfa4, 0x9f06824a7a36165f, 0x1fca17a47684e317,
+    },
+    {
+      0x8bcd7ad35098fdea, 0xf3ef6707471c43b0, 0x684c9c21ae59ce84, 0x05b4c6941cfc0dd8,
+      0x9fe39002c5aa37ae, 0x41347d7c12261f03, 0xce1b3ebca6a50d58, 0x203f77f2454127f8,
+    },
+    {
+      0x33afcfaf7675562b, 0xcd80cdbad74b12b1, 0xa71fd81ce322ae8c, 0x1986b7f4902bd4a8,
+      0x66fe24bfbc901135, 0x4795caef22baeb79, 0x504f33c66a5e22c0, 0x20c2517e2aa48938,
+    },
+  },
+  {
+    {
+      0xdfec1b592b0b6480, 0x9db064625367e472, 0xcd1c2acec0ee5c5f, 0x0f0da69896840a70,
+      0x1c817bafbb79ce8f, 0xb3a1e7c384e7916f, 0xf81bb2f324cbac42, 0x20834d320a598d68,
+    },
+    {
+      0xeb91f8fb352268e3, 0x91a1c7b986b4fe67, 0x4f733149d2281b16, 0x0a808a19619eaa9b,
+      0x7149db515d816dc7, 0xf57bd27783294397, 0xa4f7eefe8c436781, 0x1859238ac4717a1f,
+    },
+    {
+      0x99662e11339576e5, 0x9279cadf438a9609, 0x250c6656db804035, 0x1623728508895b02,
+      0x2ba8a8140ac34111, 0xcad23fb16c0a688f, 0x03b18737c70ef1d8, 0x0cc5a62397ae46d2,
+    },
+    {
+      0xcbb281f05818a2ec, 0x7f2ce82b45273277, 0x9bd5bf9fe92baf58, 0x077c2fd415551e46,
+      0x11465ee0bccc52b5, 0xb82d703a464a8345, 0x6398603fa15855d3, 0x23d4be821adfcc66,
+    },
+    {
+      0x102f7fb79823b22f, 0x2ec84122da45458b, 0x930d9870554c8925, 0x264fcf0bcc71392c,
+      0x6cf8780dc75f6900, 0x24b62bbb52dbad39, 0x6ae78e8b12171b31, 0x155bc18c50e0f77a,
+    },
+    {
+      0x9c6014c6fc0b221d, 0x2e0fb9cd9897468d, 0x4148dfa6f31b553d, 0x200479932af95e32,
+      0xa4b897f36d7e1832, 0xf2a3b72c4fd748ff, 0xec6dbbb3de159ff8, 0x19eaa359e21981f4,
+    },
+    {
+      0x61dc3a5627e95d9a, 0xf65175f428486b42, 0x8762f8de4ff13ebd, 0x0edcbff3507608c2,
+      0x143596d01be42401, 0xb2a11702fa483afe, 0x9820115880fb62ec, 0x1189c01f33b0f8a7,
+    },
+    {
+      0x0234d2fcf148f6ba, 0x6a1cdd78a43e0436, 0x53bf7f3409852d58, 0x059ca9b78d72a408,
+      0xfde4c7cd9ba1de8a, 0x1a6f9085887d5f83, 0xd076428981a5e6d1, 0x015b3f1e1289c082,
+    },
+  },
+  {
+    {
+      0x8b7efb3bdeb138bb, 0xde5525b4385ba52d, 0x18683f2e3d2f59ca, 0x2f3452d52672cdeb,
+      0xa26a8aaff439c24e, 0xe30343e1bbc63baa, 0x6dc5e76ebe827270, 0x020449e870ef0dae,
+    },
+    {
+      0x67d8cbe7039ca020, 0x2801bff3a805438d, 0xcc3a0685c3a5adcc, 0x207bb1e7c6455a6c,
+      0x214d137bf4740221, 0x9cfdd8a43ee79ea9, 0xa25d1e5d525403b6, 0x182c98741e8b45cb,
+    },
+    {
+      0x5b5d1949eda55e0b, 0xba9ad82c983d82b3, 0xdb30760caa882885, 0x2574f85cbbd3416c,
+      0x58262a7ed038bd5b, 0x83bb074d04dd2119, 0x6143b0a17361c8ba, 0x2e13a5704fa69856,
+    },
+    {
+      0x57b80c7fff27d48a, 0xd5cb9ffb2b5736c2, 0xfa930f82ad4830e9, 0x09b5bfa90e61b02d,
+      0xf5323ea3672a6fd0, 0xadb584fd2b2a6ff3, 0x81371784b8a0fc1c, 0x1a739f475947e5d0,
+    },
+    {
+      0xc18652513a49235b, 0xfca8d8390ca1b2b3, 0x832ee4f57d52a209, 0x15e56137e18fabd6,
+      0xda750e6f33208663, 0x8bb96a6d0f4246fd, 0xc7945c52bcf74388, 0x28c21700c5e65f52,
+    },
+    {
+      0x0927e4723917dc94, 0x782a73470fbd6e54, 0xb3cdbc5773c2efe9, 0x01eff3ebc9894ac4,
+      0xe1e1ea3828e3e343, 0x6c077fd955f832ff, 0xe23cba8f48c42d1a, 0x01cc1917a85a429b,
+    },
+    {
+      0x97f63ad240119bef, 0xf27dd520788fddaf, 0x7c54917a9f21abfc, 0x24ee8e23a6676d87,
+      0x7a01f7c379f98446, 0xfc6fd60d0418cb33, 0x5d6367e70df4e7fd, 0x195728ebadea99fa,
+    },
+    {
+      0xc11144ea75c70f65, 0xc5531807b6b46893, 0x4ae21cbd79b4e3c7, 0x15d5c031288b351d,
+      0x37fc164797c9e3f2, 0xcc5f2c330aacf9d5, 0x3b47d47481f4068b, 0x08cf68a83e9ee334,
+    },
+  },
+  {
+    {
+      0x3337de80abbe0a55, 0x9dc24a9454bf54e7, 0xd2f4da1325f6842c, 0x1609f0fafec8a3de,
+      0x8277949fad55ab9a, 0x79fdc960809ca71b, 0x3d15a091c1109641, 0x09f1bc3b825cabfe,
+    },
+    {
+      0x452dfd9f5961b7f9, 0x38c833a46eaa9e8a, 0x80326d3fd7a14063, 0x1084959ea7a307ee,
+      0x4e3f874725a1a134, 0x9bf637994caf7bf2, 0x718bb45cde762c98, 0x01f904098f50d92f,
+    },
+    {
+      0x2b0fe87496b7c23a, 0xde99cd8f4347fc16, 0xe13ae1ce38eabda0, 0x2147c558163925f3,
+      0x998d1c370e29440e, 0x8ec2311efc69f6bc, 0xd21e4dc907444698, 0x134335cf95dd99ea,
+    },
+    {
+      0xfb4bb5e083a2c14f, 0xfce0561dd4ab29f2, 0x664151c87d554124, 0x1a103ab846b99a94,
+      0x6ded870064b8a896, 0x9dcb3a63b6bb6057, 0x90cc019d8aaedaf9, 0x0d8e1c84f78d6456,
+    },
+    {
+      0xdb3b3c19c7b74a02, 0x665b5c6562b54aea, 0x5a7e8606a4cb5510, 0x1b2c58826b8daf98,
+      0xf1b19946136814ea, 0x2a46b0ed055d31cd, 0xc00a85fd6b91b6b1, 0x19551710f8659e96,
+    },
+    {
+      0xb0061ef54f331575, 0x7708f4df1ee90272, 0xf846eb1de7f11020, 0x24f942cc7986d9e8,
+      0x810a9a0644814a09, 0xa6a884a367c70d01, 0xfe3944f2e6b1b38e, 0x06afc931c8226421,
+    },
+    {
+      0x9dc22286f2d72251, 0xf1de02cf343b11fa, 0xa511aae320fb4b2f, 0x20166ea6f9a94f6e,
+      0x73bb61d80e48b14f, 0xeb24520c297ac7b8, 0xcaa3f02b6b626285, 0x2166d01f9bd5f507,
+    },
+    {
+      0x611feaa9abe58bbf, 0x3ddca1fb08721089, 0x283fbd6f05ba4384, 0x1a139db1329143a7,
+      0x0bb997fcf5bd33fb, 0xfc7b87fa6df0146e, 0x7fde4c31f328904b, 0x1af1b81a88bd6b10,
+    },
+  },
+  {
+    {
+      0x2ee47d6b36cabd3a, 0xcc65671618109937, 0x2d0e9111ce5cb946, 0x01e3d2485e9d5ec8,
+      0xc4d18da19df3cdfc, 0x2183e56fba9109d9, 0x07b21f6b38d98141, 0x2f307ecf0318d77b,
+    },
+    {
+      0xdb11c945d8e7e849, 0x5006b1ed424233b5, 0xe88d639556dc5219, 0x2779ec9bfc8e34ce,
+      0xa6a78e4f4858a864, 0x1a0b9f4bc38bbe31, 0x0585231054be5ccd, 0x27c39482935053e0,
+    },
+    {
+      0x3d0b7e8d8390d91c, 0xc7e036fa467cbb4b, 0x37b7a8c71676459a, 0x1043d1e1a11052b7,
+      0xb7bff5e4f63df676, 0x4a4eddf9d2c516dc, 0x6933bcdc8be5919a, 0x0b11a408b629b0d5,
+    },
+    {
+      0xaedefd5b905c1a8a, 0xfdfbf850091b92d0, 0x02b8ece4fe155add, 0x2a4c300f67c56617,
+      0xc2cd6d0f135876f3, 0x490f9866268793dd, 0xc3ab376b09f6ba3a, 0x211717f01e2bbdfa,
+    },
+    {
+      0xcc2f894b9e6e5d05, 0x0b4bce16ed0c8505, 0x931d315ea8893b22, 0x0116bff47565e300,
+      0xd16fa93cb1405148, 0xa3fd3107a22d41fc, 0x50c8d49744176b25, 0x2c324615e8107e0a,
+    },
+    {
+      0xd5f8e0967d32835f, 0x9083519c62204c14, 0x3afbdbd31fde3e8a, 0x02dbdc2c91a44295,
+      0xf01b32e7366afa51, 0xf1f1884e13c159fb, 0x24196c41af282183, 0x09fdce9972c83072,
+    },
+    {
+      0x10ad2e6a3113cba4, 0x347f1a688226d294, 0x2951d9291935b742, 0x23b5b4db9a04d2f0,
+      0xc07e5eeacd4abb5c, 0xbf68cd3511e35f11, 0xd45bef08dafb05ca, 0x22828b9888526e41,
+    },
+    {
+      0x41f4485f5d7473ac, 0x57f1c456fb8c52f0, 0x2e615c08807adb08, 0x2513936c381dd877,
+      0xff4d6aff81cf7e7c, 0x5326de2f719ed9e6, 0xdc171239566a4066, 0x031046ee78986752,
+    },
+  },
+  {
+    {
+      0xc47ea1899b8ec89e, 0x5e7e46675a79e35f, 0x2d9dfd475c05b2c9, 0x00a50db7dd33f1da,
+      0x71cdf57043489594, 0xcd4052a7c5e89e1e, 0x35d861d0fbca67ec, 0x02a32e99568a96d0,
+    },
+    {
+      0xd4ba972247759273, 0x4d06c7a9c24f1929, 0xc1aa7ea52d3a7b9f, 0x258c73604bd53078,
+      0xa2cb18c51dd60886, 0x99a758d3df004074, 0x715c07c9f6ee417c, 0x11669f87b425bf52,
+    },
+    {
+      0x9b88bf7c329da2c9, 0xf3925e6697259f91, 0x43e6a15545c9a435, 0x0edb682474386687,
+      0x78cff6059acad497, 0xa9629b589a91755d, 0x46ec1b56c967a244, 0x177837b4f81cb0e8,
+    },
+    {
+      0xe6eff0a236822af7, 0xedb517a29b60fdc0, 0xf5fd19153410c347, 0x0f9822b51d135ee7,
+      0xcd690796501b442f, 0xa01969c046847601, 0x4b312b96d1e6207b, 0x137b04a02f3a16b4,
+    },
+    {
+      0x3ab1824c6ac16422, 0x7cbb430ccc8e3c82, 0xe9d9b00eb1ae4c7d, 0x02a01af67351a78e,
+      0xc144df7b16454e25, 0xc7ee55f27d2206ba, 0x0a65e6c43bf4d494, 0x111f2a1445ed52ac,
+    },
+    {
+      0x1d010059260a6090, 0x569fcacbf78b4ba8, 0x089cb9bc6cd78a34, 0x014dd2e71a79b575,
+      0x3da61777d247f6b1, 0xd6ebd65be3319d27, 0x7b3ef97a01b2b452, 0x29cf09a5e1e0cd7f,
+    },
+    {
+      0xe42a7584f7292991, 0xafa23f2922c98ae0, 0xf3145c0d10108164, 0x225a7b726eb3c065,
+      0xe9140e67a325b505, 0xb303bf43227ebcfb, 0x9e9f92ab85de8965, 0x11fd2d43644fd9f7,
+    },
+    {
+      0x65436bc3631a7f4c, 0x74c85e9216eb01ea, 0xf6eb473fa14f713c, 0x26ae262fd661716d,
+      0x8b9bab415887bc32, 0x67268d4e366d4bb4, 0x66149cf0a5e1c531, 0x2bff4801e4b26ab2,
+    },
+  },
+  {
+    {
+      0x6da61794b1b35171, 0x098fc52d8e5ca3c9, 0x8f5f82d5e5a46402, 0x14fc673f38aea760,
+      0x4c5858e16c5d948d, 0xe5e6830455f84104, 0x2525deb147048fcd, 0x1995ad1b84b0b311,
+    },
+    {
+      0xf19b062cf5d9c5c6, 0xd9ffa51fcb748eac, 0x8f5ac30cfed78f59, 0x0d4e592940169969,
+      0xb5f6b5283fc76f1e, 0xfed0d9f92124aa64, 0xfb8a17bca17093d2, 0x00c5dcba9a565421,
+    },
+    {
+      0x8c6d5cafecb71a1e, 0xedfc12a70dc346bc, 0xa8e4c46d9628212d, 0x1e4f95de69f2f3cb,
+      0xeb8ac04bd88e1b5b, 0x3e0413532cdf365c, 0xe025ba08f9e6a1bc, 0x0e17e2b2bde0be8d,
+    },
+    {
+      0x0c6fde8c5932344c, 0x183d1289f7025ef2, 0xd565cf49edb5c8bd, 0x16316f3d882ea7a4,
+      0x1659599aa8b401a4, 0x16491a8c6bc73323, 0x8c67f7d296f9f782, 0x2902fb3713f8a511,
+    },
+    {
+      0x4fff6d53bb1fbca1, 0x9dfc48250f5f80a4, 0x650530fd14d8e866, 0x1588880773490590,
+      0xd24fb27ec8a94b6b, 0x062ae703bcac0880, 0xf3ed82c66f605c02, 0x0127bad5f28f3593,
+    },
+    {
+      0xe2103ece284084da, 0xce8616ea758e656c, 0xf4f80358e9db0c88, 0x2e9d4df6172af40b,
+      0x95b2f9c568fe547d, 0x847bd83debf84ffa, 0x551e2dd67aa59328, 0x17f677242f2d704a,
+    },
+    {
+      0x7789d7a7b85cc520, 0xab1f03061ab73264, 0x84df273adcd4557f, 0x00b300c21a1a0a6c,
+      0xa2d21f9d431d743e, 0x633cca27a29bb114, 0x01f2167012788b46, 0x234a0fd8f58af495,
+    },
+    {
+      0xd312fc869bafd877, 0x3f112be5a8719e05, 0xdaba0a71c1cfc225, 0x2c4ab15043938fbb,
+      0x793f017a0bab126b, 0x027cc886ada9d2c1, 0x95d158ba9978e72c, 0x242e48650fc8e36f,
+    },
+  },
+  {
+    {
+      0x19c33a09fdf354c6, 0xb417b5375795f5c9, 0x9e8bb5ba3a8b50ce, 0x14f50b9bc2efa1ad,
+      0x32ef7995a4b60c95, 0x780f6ae01a1fd352, 0x10b0961f594d7367, 0x196a303f382e3265,
+    },
+    {
+      0x5c1c63de408f0278, 0xf9adf89582e5bc06, 0x1aec1b0165f72d4d, 0x0e89dd621b576a9d,
+      0x4c8fafbc86fe78bb, 0x251a37ca36370d5b, 0x12ebdd3bafa987a1, 0x11ee3e8832cd6e5f,
+    },
+    {
+      0x0f52325a531180f8, 0x47fccb582410c69b, 0x3edc5c35d08c5da0, 0x1daa6357ff6be8c6,
+      0xc9171b4b3d08b6ba, 0xf6a5cf9e306800ea, 0x4c0d6b41d08208a4, 0x2b0a6a472e2bfb9a,
+    },
+    {
+      0xe063729d609ae31a, 0x1c2edce6ff82a848, 0x7fcfae2abe27a116, 0x0250ed7c86e747fa,
+      0x7cd2356a0caf9678, 0x7cb1c21f98ce584e, 0x38320de9a916ae17, 0x246630c6131f19c5,
+    },
+    {
+      0x4d03a329db90dfe4, 0xedd28ffb6c73e5f1, 0xb7a6665e36f9c6fc, 0x066d47efdfdda3aa,
+      0x5b9ed58c1190875c, 0x9401dd2ab56b0957, 0xf53b19d53b90f506, 0x2f4f319207699a0e,
+    },
+    {
+      0x96e51a4908b92884, 0x88860d145cd60541, 0x038a1e8243450bb5, 0x1a21ea033e4227e7,
+      0x3472cd7d60401baf, 0x1c5f8b3439c1fbf6, 0x8508cf0a3d88bedb, 0x1a88a98fef3a43a0,
+    },
+    {
+      0x8923922699202847, 0xf30f38595d96fd1b, 0xe39c7b30aec43804, 0x03f5bb8097e9cb6d,
+      0xc25e921f5d489f0d, 0x1a8632cfb206880b, 0xb124515290d18598, 0x0fabbb1c1aafb900,
+    },
+    {
+      0x868b948cb2670956, 0x6f9eb021190adcdf, 0x755e49327b530212, 0x2e22a1ee1d2398ec,
+      0x49d914bc9643754d, 0xeb5510df2fac1319, 0x2e3ea12ad51b0d92, 0x238d8dffb3b71aea,
+    },
+  },
+  {
+    {
+      0xc26875487a722ffd, 0x10c2c92cbc1f363e, 0x5aca999c93f1fd03, 0x10e458cb1a6b224c,
+      0x827c1c9132635d53, 0xf7b0ea3def4def57, 0xd0e0f0a39abf7666, 0x2aeb267a24042163,
+    },
+    {
+      0xca993444d7a26cae, 0xc6b872baae7680b3, 0xd0e27177395f66c9, 0x270590c3ff3464ba,
+      0x6ec05fec677b91a2, 0x496e4c2c6d54a2d7, 0xadb9485ed15f7df6, 0x06b9ea61f32c8fcc,
+    },
+    {
+      0x1b2cff6c3cce010f, 0x33c46aa922c9322d, 0xef43e26f238884d0, 0x01be9a70171472e1,
+      0x50fcc4e3988df60a, 0x7cea620e223b723c, 0x211bd3e5ca8acf5b, 0x1927e38a730c2369,
+    },
+    {
+      0x839f10ba9827d060, 0x0b2ed3c0a6e05983, 0x4228f1429474000f, 0x1487070a26b21332,
+      0x29872d8b51d571f5, 0x519c9b71af5cd0b3, 0xacf9829b6d7006fe, 0x0eb64e8e8ee79073,
+    },
+    {
+      0x7bf50fce3a3e3dd3, 0xad51ed37abfbe475, 0xcdfc0617b2194445, 0x194613013c7dcaed,
+      0x490a562afa5bcc87, 0x1fc8cad64e4291cb, 0x5e78ba5008101016, 0x0273a69d8715bfd0,
+    },
+    {
+      0x750a292b7c0fdebc, 0xb19c661943f71303, 0x84ac2ed65ee7e9b3, 0x0217341839a41c39,
+      0x3b9e3cfe1196f5d4, 0x0b45c9aae7f6ed4e, 0x7ad9ad88c064bae9, 0x109e169f75ca2bb5,
+    },
+    {
+      0x86872c42b9c89c49, 0x9f0ffd8bd57b3ee9, 0x9b767c6dd2e76b71, 0x2304014a18339ae9,
+      0x037d6341e7acec6e, 0x8d74e5ee0b9608a7, 0xf4e1ee518fdd4dd8, 0x109e4b4861092d6b,
+    },
+    {
+      0x61b77008b965917e, 0x14dfd6787948f967, 0x4af4233ccaeef86b, 0x2f48c6226c1e9b59,
+      0xae6ebd14dd3bac5b, 0xff58cb912b5d5354, 0x13fa288c4784e7b1, 0x1b95df401fed7e45,
+    },
+  },
+  {
+    {
+      0xf80be9f298e56d69, 0x17e1dc75cbcaa2e3, 0xc253091024df0be2, 0x1275873204a4c16a,
+      0x66ac87eaa9480df9, 0x9b3df47da7bf8eee, 0x796ad2702656ac1f, 0x1c52129b1ad09fa4,
+    },
+    {
+      0xda0887bfb3c0fc2a, 0x742b6a9b2b962334, 0x57889afd6510b269, 0x194238bf99c293aa,
+      0x76d711f43bd2d659, 0x9ec28e0e03520b3d, 0x958fa9ce5d3115e5, 0x02fedfd81630c785,
+    },
+    {
+      0xb9696c2df1f6b6fe, 0x361674fffe2f3a92, 0x72a12d8757e27550, 0x152b1573eba32df6,
+      0xda64718ab21c1a94, 0x7a61f01b9080e946, 0x585fb2df844fd639, 0x29327b4d528af0fc,
+    },
+    {
+      0xa8138ed989023dce, 0xa14c1ec2dc43f7a7, 0x4fa366d6302496f3, 0x235a9a3dd6f7fccf,
+      0xaeeac218d2f949af, 0x7209b36a558a8750, 0x83a41a9997d0bead, 0x03a4eb471a062e12,
+    },
+    {
+      0x4e7749a0d1ce8ce2, 0x12319bbacb25baf2, 0x10c65e3a99769092, 0x1b336e02d1242a73,
+      0x2927f71787903c78, 0x4dc7555c979c1681, 0xa8bbb0ac4683b21e, 0x26c7953f6a975561,
+    },
+    {
+      0x1875bd2435b52a87, 0x691d93f4138ec8be, 0x4829bb60271f80e3, 0x24374a26b5a870eb,
+      0x5007240f4d7d506c, 0x3ffb09947507d29d, 0x678a8bcf64dc9294, 0x01b3b2222f06dce3,
+    },
+    {
+      0x66df479fc32a0576, 0x142e90751ea3bf44, 0xf6ed5f902c8e746f, 0x16e2f3eedb8e97aa,
+      0x44241ea5c5ca59e5, 0xaa3a949543e7392c, 0x0af5356037d570fd, 0x2d146ce8f8a61557,
+    },
+    {
+      0xac2c7da6fc507897, 0xbbe17149beeb07ea, 0xc7d30b476375a57d, 0x0a524d2d05a75f99,
+      0x72bbbccae5bea9ec, 0x0a8d988e5c4fc07e, 0xa59d28c4ccf2090e, 0x0e96c69a8bf6c97d,
+    },
+  },
+  {
+    {
+      0x9cdb1e0435db7e1e, 0x2a88391f6b22ec9c, 0xa88c45d42a66f1a0, 0x0452d2ba8ac94f5c,
+      0x5370be1206a913f1, 0x943476d1817c9db3, 0xe2faa259d66642b0, 0x022235dba06b829b,
+    },
+    {
+      0x3dc26dac1801bb40, 0x88ff9c9b0131209c, 0x9228539cba9cd0ff, 0x0615edbb6ef7c3c3,
+      0x94b069ff2259cdab, 0xf2301dc394ccf04a, 0xcbedbafcbd890f73, 0x017545567b92289e,
+    },
+    {
+      0x47f776deede159e5, 0x43891c86cea29c53, 0x0576c20b13448d7c, 0x0704ddb6a919e87a,
+      0x57e91a6ce9b5d4f3, 0xc5a63315ac12dd13, 0x859c5f59636f4440, 0x20b0784aa339e701,
+    },
+    {
+      0x6f55e6d50aeeac9b, 0x8fc0d66b8bc96f8b, 0x612c5bef73fcfe4f, 0x059e4b280e50345d,
+      0xba01e1eea06fe369, 0x63c8649fa80d08b2, 0x58436a6d93871ab4, 0x221a06388a3bb644,
+    },
+    {
+      0x0bfae34dc78e9a0a, 0xecef43f960e1ca67, 0x60fa743f4321ca9f, 0x09cd8410da80bba5,
+      0x5138584379ecbee3, 0xf0e9a9519ca82d5b, 0x8383e8cb336acd66, 0x110740441430abd4,
+    },
+    {
+      0xff065f218d4cf9d0, 0x31b09fe07af63159, 0x08154eda4ccbde8d, 0x2a13e9cd82623e06,
+      0xbd6b429e964ea28c, 0x1fdc1a5328628d6f, 0xef3e02f8d9aa800f, 0x04bf647946d923cd,
+    },
+    {
+      0x55f6c7e0e677cc62, 0x3bdaf28346f6f860, 0x1fb33d106a32bbf4, 0x25af5bee3b7a9d2a,
+      0x6147509a7bd69ae9, 0xeac43d9a4218c456, 0xf43f476454ed46bd, 0x266f456ed74f425b,
+    },
+    {
+      0x9192efdf7b6c85a3, 0x3dd837be46b31e75, 0x4540702025063bbd, 0x03b4ad3929e2c50b,
+      0x4d1c5eb26061975e, 0x1e9adf1bbe6e8c50, 0x274592a9c63306e0, 0x03d06b5dc1f0cbb3,
+    },
+  },
+  {
+    {
+      0x09956eb938c1ab1c, 0xa48a94416e752539, 0x32ac9f31911b932c, 0x26af441ebf132bd9,
+      0xe9ba725713bdc1f6, 0x431765279b3ad7b2, 0xdc5281706791c5d2, 0x0515a29daec1a61e,
+    },
+    {
+      0x5a3406df51bd20dc, 0xa96b3892d8928bca, 0x1b7be4c2ebd3ee7f, 0x11d68e8d332155d6,
+      0xe7951cc931dd2656, 0x47165ce2528713a5, 0xfbb5346fb34ef0c4, 0x0d29a364047d7783,
+    },
+    {
+      0x16b04cbed195418b, 0x490bbaaf450130b9, 0xf92fe3172e1abefb, 0x1d48884956232fec,
+      0x1fee880bd7d3ed7e, 0x1fe52de975f80e19, 0xfa1f64da501db3e6, 0x2e75df21a97884a4,
+    },
+    {
+      0xfc5eda3ce66afa29, 0x1aae458b30e7f9a4, 0x7fc9af5ea50c8e10, 0x116c5795dcb35bd8,
+      0xf9ffdebc811fec82, 0x12b95ed3dba3be5c, 0x038c09ecf4361488, 0x0137396e1440d46b,
+    },
+    {
+      0x712bad4574f587ea, 0x66ee007123096fc5, 0xd1b144524f61e5a6, 0x1f0b3559b3e264da,
+      0xb27d3057ce655f13, 0x64b3bf2286ecb3fc, 0x1dfaf2046b3db236, 0x2dc0ab1d3148e7a8,
+    },
+    {
+      0xcbe24e2a4bb0d185, 0xffce7b13c928b0cc, 0xc0fa629ffac326f9, 0x0e693a9a151d9286,
+      0x4789dbfd90251f0e, 0x1dbe714fa3934484, 0x2ece1a010d1e7a1a, 0x190cb701f1e7d51f,
+    },
+    {
+      0x2381fec848d2671b, 0x1ea1b4f1d95bdc54, 0xbd1c8b3fa4f74abd, 0x1f54329bf1130a8e,
+      0xca96fbbbac25a243, 0xa8ac56a4ee4c730c, 0xb5f79031a8e379ed, 0x0568d646f808ef18,
+    },
+    {
+      0x8a40247ba111a128, 0x24703b2b17edc2a0, 0x0783702e7de91684, 0x1feacd2cbdc25582,
+      0x4f406bad120b2c2d, 0xddeaced59751406e, 0x4a3024768c5b7125, 0x2b7c880154e966db,
+    },
+  },
+  {
+    {
+      0x6c25061ba61c43cd, 0x3b99232f0cd4d797, 0x0f168e1d02f982cd, 0x0f89432d0d700a69,
+      0x4453fcbd96c45044, 0xf8f3438d40e01f30, 0x5b53a957d0cef6ff, 0x1108eb08241f8d1e,
+    },
+    {
+      0x17c4fa0b0f052d07, 0x93d56e4ac0861ed5, 0x5181dff86b36e9b0, 0x1d89798ea136f51a,
+      0xdc32ee3e83decdbf, 0x0b7f9233bceafeb0, 0x498dca03041e03a9, 0x055a7148b3f7b9b7,
+    },
+    {
+      0xbcd6600515bc7224, 0xcead1eb486791041, 0x710bac69c7b436f7, 0x185b3c4a1341bff0,
+      0xf4c0845dab91c604, 0x900e30992411d56b, 0x5f6e3ad24272aa3e, 0x103a7932018aca2d,
+    },
+    {
+      0x23f5463e234193ba, 0x110ffc1c80dc2643, 0xb6252a6fcaef1679, 0x203dbef95d790e35,
+      0xdef49c4014bac570, 0xffbbe432c0376630, 0x5e34e6a055cc8905, 0x2e7edb73ef2eb57a,
+    },
+    {
+      0xc0eb47f8b59e3b53, 0x7a4599c5d20c5011, 0xbeff44876976ad80, 0x162cfbd3a0955c30,
+      0xa7ad1d115aeaa3d3, 0xb4ad1986307fd17f, 0x32856a3c7a312581, 0x0ee39a1e720442b3,
+    },
+    {
+      0xea7d261ea18f5a73, 0x22da575c13080b29, 0x66d74fa9dfcd17ed, 0x0641cbfe534f1cc3,
+      0xddbf647ab18eb09e, 0x5347325918561efa, 0xce4abaaef112ac54, 0x1b8814dc7b42b124,
+    },
+    {
+      0x57f31bf81d04e4d4, 0x83e7a6efad87851e, 0xef1563b02af4abe0, 0x15f91290a53c2185,
+      0x8c3f48a0809fbde5, 0x956ff0d548440152, 0xcba4615532aeea44, 0x05b133086a0b726a,
+    },
+    {
+      0x66ff8c1c82166e4b, 0x3141913dcf7f883f, 0xa6f8ce91fd08700b, 0x0a3a907f326a3496,
+      0xcbe041685616705a, 0x4e0088d58d355465, 0x6b2306c155951186, 0x211ae061ca74862e,
+    },
+  },
+  {
+    {
+      0x0818860720bbc77a, 0x1c71a852a999fe66, 0x7ffdb09f14892507, 0x232734d5ac1b8f60,
+      0x2d6327868a8ddd83, 0x58c73d9ddd5a067b, 0xfe0ae074826629d0, 0x2343667358e33df2,
+    },
+    {
+      0x0e4c29781625c5fb, 0x343291c5b1b697cb, 0xc9fad19c707d9937, 0x24472eddde0134b0,
+      0xedc632dde4bfce06, 0x7d758ccbd49f970c, 0xf1e431e0cc39a09e, 0x25a940ad1c3c6698,
+    },
+    {
+      0xd9f812d7b48a626e, 0xd14f0d2ef34f7fcb, 0xc53d1edb05f28355, 0x0389e42e80c20e17,
+      0x1d18166a732e2625, 0xe6e001d1a45c78ba, 0x52526e0286df7450, 0x0dfec232b5fb9365,
+    },
+    {
+      0x7204238a011c41fb, 0xa7189354371e2674, 0x58154b13b1ac56fe, 0x25e0a37613eb80f0,
+      0x92ae916e8d5fee20, 0x5b17d5a24cdac74d, 0x22a87d36a81aa193, 0x0c1b89600fb1c70c,
+    },
+    {
+      0xade7cb6ff4bf190e, 0xba449efa9a68d466, 0x4d2a53a05d736d09, 0x2ec8e7d1520d5f0c,
+      0x6ebe366083f6ce1c, 0x60999ef011327d00, 0x728ea4b89e607222, 0x1d474f4e4e900ce0,
+    },
+    {
+      0x6226e9f81a52bf4e, 0xaceea419d3a06cb9, 0xd7b3bcf6edf30059, 0x18bde5d55516a825,
+      0xd9794674433b44c6, 0x5fa16b1804aed11e, 0x4413d9cd9807bdfd, 0x1c4a2ff37f08a744,
+    },
+    {
+      0xd59c9654e7da52fe, 0x8a0982c07f3ad93d, 0x933b638c4d628ee9, 0x2187d96a9c3b36e1,
+      0x5fbb48b206bbab5e, 0xb791a5706fd6ffc6, 0x891aad8aacc31235, 0x223ae8e944638425,
+    },
+    {
+      0x441f8104991523e8, 0xd17d8e023a5bb5d8, 0xc11392365a2b9985, 0x0867ae01f37eb9ff,
+      0x6d69f41923039aa2, 0x69d1be68642ed5f1, 0xec65c94bcfa26eba, 0x268d81be687b0fc5,
+    },
+  },
+  {
+    {
+      0x0f677c6e92deb502, 0x64d74e87a80e36ae, 0xcc6ed67c903feeb3, 0x0b3f4208fcbeedc5,
+      0x703144a49211aecd, 0x9a03cb517dbb504d, 0x29f010effbc3e197, 0x20ecdae8f20226e4,
+    },
+    {
+      0x9063f5ac2e020fa7, 0x89cbab7e81edff49, 0x3af9fc41c237ac9e, 0x2a4e3835d209f963,
+      0x22cf4e4e699f831b, 0xadee2195bbe8a46c, 0xa36744bc01338798, 0x0546f586f13eba5d,
+    },
+    {
+      0x7cab5d85857828a2, 0x16557f6bc50e5aa6, 0x6a5c2bdf25a34c47, 0x11fc592f262ed2c7,
+      0xc71f7932e481dd48, 0x65c62d0ad1ee2698, 0x612f1a35b1d518ac, 0x0070cf47025862aa,
+    },
+    {
+      0xb0e4fec80e050fd9, 0x355203e3e6c049fb, 0x5c3524f1a9eab2ec, 0x05812a9952e6525b,
+      0x399471224e18e52b, 0xd441d9f8d2492c7b, 0x56c22e9aedb17690, 0x14a11d9bd412f641,
+    },
+    {
+      0x74445fbc6c8dc819, 0x05f5dc7562ff91bc, 0x3354d067bfd9d7fa, 0x1ff0dc57ca9861eb,
+      0x93d728fbff1abf44, 0x434c56cd481c18d8, 0x91f0331348cba8b0, 0x19ced9c57f1a3c76,
+    },
+    {
+      0x46925b9c9c7f6ffd, 0x189eb75ba97a1bbc, 0xbea6ce1fdd2f7fea, 0x16e535d721464324,
+      0x63b8460590afd622, 0x5a343b6224ed27eb, 0xfd79792209a35307, 0x2c158c225264e464,
+    },
+    {
+      0x49bdc3501770b1ee, 0x4785df2e0450818f, 0x97c50c46f02be92e, 0x29deb4b5cf1609df,
+      0xc3cf1cf2cedf4794, 0xbc85017a59ef6b41, 0x3b18a9c3de46be83, 0x1b526c6fe0b2f7c6,
+    },
+    {
+      0x7e7550d6a9cc5f3f, 0xf894b46e08ff31c6, 0x8fe5c68c45176480, 0x03e7c36bb5ee4b94,
+      0x8175ddff1bcac302, 0x99346b0df07adf0f, 0x85233c2c226831d9, 0x1e4d514b7cbc92c1,
+    },
+  },
+  {
+    {
+      0x7258706f5a0bc27c, 0xbf617b73286fccd2, 0xb9a34ac9be71cc6f, 0x1753b621a501d705,
+      0xea712bb7c79f9494, 0xccbe0fa557bfe604, 0x347380f05ca82f57, 0x29c4d9c4ece3b11b,
+    },
+    {
+      0xb75a453f2358dade, 0xa09cb8e2770c7550, 0x6592c169e0a44d0f, 0x0d74a9b31a5c01da,
+      0x3f4612b5036f4432, 0x64e109e1277d4dca, 0x99aff7b1dac1f638, 0x089059ee6882684b,
+    },
+    {
+      0xb932c5ef7b77524b, 0xd0524e3bca6d1e3b, 0xc1573305262322dd, 0x1473841b5e9b9640,
+      0x53fa72e2d6e64adb, 0xb901188b642fe7df, 0x4c36feece1334cc0, 0x02c79cb5848c528b,
+    },
+    {
+      0x54d21dfe7f8fd230, 0x4072745b8def677b, 0x886951ff2e01922b, 0x03c46bb537e537e6,
+      0x93b40e63c19135c0, 0x1482324995acf944, 0xbac0cd1bd74e06b7, 0x289ff1bb528a0311,
+    },
+    {
+      0xdd51dca576d46299, 0xb12cc55752e5bcbd, 0xd5f8e8d1a0fc33ae, 0x17de4d29050e9042,
+      0xda25db989d391a43, 0x65f44402ac0f3e5b, 0xe61548890bca5a1a, 0x1227e290d613d385,
+    },
+    {
+      0x46f03e035c2f9e2a, 0xfe1626b74bff9db6, 0x9b9e1e08fbc0f0ff, 0x0081587145dc619d,
+      0xd02f005ef44fe3e2, 0xb2df569fa5e3d4fa, 0xb23e86d6daaf7c59, 0x2d0e463a105031d5,
+    },
+    {
+      0x83cb0e8d481e1804, 0x4dd475464664c0f4, 0xf91d8eb6450e4ada, 0x252ac210f8544b5b,
+      0x0b55a4581591fb13, 0x27c899745b8c0687, 0x332ba3fb494c92d2, 0x1d41d824805b151a,
+    },
+    {
+      0x39931098435df4fa, 0x46aca155ff9774c1, 0x0117ff2c7d9cefa4, 0x1663512475d1747f,
+      0xcaef47188c9524d1, 0x62bd518e2e3b43ce, 0x0ffa600a77f4f3d7, 0x0f2bdb4f646deb3a,
+    },
+  },
+  {
+    {
+      0x028c16612201e795, 0x172a79ded4146912, 0xaa8aa2d5389166e9, 0x2bb65aa175cf121a,
+      0x1409bd168e7c101c, 0xf07055606e89ae96, 0x862c53cf07ba733f, 0x049b2baa342b60e9,
+    },
+    {
+      0xe5d3a4cd9b213dd7, 0xdec6efbbd0c09c94, 0x8ebb33da05fca56b, 0x20add7051e2188c6,
+      0x8c3006d0a3088799, 0xd2f568b2a699f107, 0x7fc7b67e2964f373, 0x131d123cac5dd218,
+    },
+    {
+      0x27f20bec99c5ad05, 0xf01cb8bef82550b2, 0xd66a356e1f959f6f, 0x1d6ea8b291b33799,
+      0x0e1191bf76a813c4, 0x557572f5c3057eb2, 0xdcc364e56d05c061, 0x21b3427898b1c1c1,
+    },
+    {
+      0xcf5c59cfbb9755b3, 0x4b8a9423acf5ca10, 0x0ad5c04901148989, 0x2b20e7967da23714,
+      0xdaaaf91e6c78d765, 0x6547d40fc96d4a4c, 0x67ed533856fde6d6, 0x19626c479c3ced46,
+    },
+    {
+      0x97408f1d1f022597, 0xd880a19d9f7218d0, 0xb1106cfb9bfed250, 0x28ca4bf38ffe18c8,
+      0x24b0ca47af0d7f28, 0x84b350fd98f123a7, 0xb19f1a9ddaa69071, 0x2bbee2782ad59214,
+    },
+    {
+      0x0d015c8e90e82ac5, 0xf55dca2de9359f1e, 0x1e20b44478b793ca, 0x1a916e20cb96a52e,
+      0x08c963f28e444ab9, 0x257ec9e15396da65, 0xb91eaeb4517e3dd0, 0x0fe7718c8388c497,
+    },
+    {
+      0xad922d34ae5bb20c, 0xc5edc107767d36f0, 0x92d5f480fc51507e, 0x144f59385ffba4ee,
+      0x1ca12490646367c1, 0xd75c931cc7a19044, 0x8933e6484b656316, 0x0915bdbc984267f0,
+    },
+    {
+      0x5141406b6f95522a, 0xf1242f26fd14c9f6, 0xaa2ccd63834b5943, 0x203a9362aaab4613,
+      0x1c7fe3f5aba842f6, 0xd2c278126372a3ba, 0x1016b5da0e958159, 0x1bdd2193676d7c12,
+    },
+  },
+  {
+    {
+      0x85ac634006221b7d, 0x3cfec6948f1b042f, 0x9081f8dc20678956, 0x2450be8b09674b20,
+      0x4e5122768124c93a, 0x8f8eb41e6655ba87, 0x5653c1452cf5ac99, 0x0214e80b18a39d3d,
+    },
+    {
+      0x830d974e5899a45f, 0x64d176d3cedc8d9a, 0x392b662bc2dc1762, 0x12110b3bb5ac7d69,
+      0x51b9a5611c557138, 0x14393cf9f053d676, 0x1fbe33a870fb056a, 0x25d85509814f6ec2,
+    },
+    {
+      0x929b419cd661f3f5, 0x1e3960f93cef5e7c, 0x07c0e5a7b8e527f4, 0x126578430a502a67,
+      0x4c4af4a1125af5f2, 0xd597d89513ee24b6, 0x48bf6540b304e099, 0x0361a9250fa44bdf,
+    },
+    {
+      0xade1fcc02241388e, 0x8ff14b79bf2c5837, 0xa09b6b67beb46b7a, 0x132447d8d1315610,
+      0x8849078e2ca548fb, 0x4fbae5f6b2665713, 0x4a74a6b117961cd5, 0x2c39f32e7f70caa0,
+    },
+    {
+      0x513518de787d679c, 0x69d0f3c078f50b48, 0xec784b62b76c408f, 0x0dbbe992d483ceff,
+      0x17282d33a0bd9935, 0x0d3f335b5fdbd8c1, 0x5cd8a919707f607f, 0x072424020595008f,
+    },
+    {
+      0x351687679a53a11a, 0x073f1278958b4b74, 0x0af252f4779b617a, 0x25aa719d7fdbc9d8,
+      0x3b22f9a8a991a5b5, 0xa1e377c10d69246d, 0x805c389956a7f0de, 0x230b5169ee1951df,
+    },
+    {
+      0xe0e260bb8822cbff, 0x87954dcf4d8179b2, 0xf7c44f9202344bf4, 0x145f359cb5839b23,
+      0x3308eb2219b5d1f3, 0xa02d9e20db589a4e, 0x3fd634d9bcd491b2, 0x0121b564811191b1,
+    },
+    {
+      0xab9c5ac4f37a73bd, 0x6b3d1fe920340ff0, 0x6025ec0361e90134, 0x201b591be2f63c37,
+      0xb6e7151c68fea5c9, 0x0290da247c0eaa84, 0xc8bfdfcaf05b6c83, 0x07dbe4ba98dbe2dd,
+    },
+  },
+  {
+    {
+      0x8de5b3f2c882194a, 0x0935d80d30c8ef93, 0x66b401563f5aaf3e, 0x0e66666cc25ce88a,
+      0x424d8d5b746c2d80, 0x7516681304602379, 0xa0721c4acc436cc8, 0x075a8db7d8021663,
+    },
+    {
+      0x3c5a9ff72b23f043, 0xcbaf59615d572e7b, 0x04be6b22dfed4d3a, 0x29dc5bc919cefd7e,
+      0x929be9ec9dbb29b2, 0xec0358f5b0e85a66, 0xc74136b1e425f53a, 0x251dccfc5608c58d,
+    },
+    {
+      0x984d69cb76ada8ce, 0xbca3ec3cc603e1f5, 0x8bb882494bd4773c, 0x11ded5c9ad14e814,
+      0x699739aa66646e87, 0x6cdaf426200fb6b0, 0x99887414f8a91a34, 0x2a1ce0d32870227b,
+    },
+    {
+      0x53fcfb62feecb442, 0x4f136bf24e6a627d, 0xbe81e14a9731e33e, 0x1516456050dabe5a,
+      0x0923b4758bd32808, 0x9c2bae570c315a28, 0x2ca820d347012c67, 0x097f5a3cec506902,
+    },
+    {
+      0x34c3c5cd3141a02a, 0x04269337f47cf3cc, 0x13a03d203f26364a, 0x005823f0aa01ba40,
+      0xb22932ca7548ed03, 0x427b36be13eca58e, 0x9660d381faacda60, 0x209177153a01414b,
+    },
+    {
+      0xcc2277a2d68a9707, 0xabfa3d8cf954f5aa, 0xffa3a7f0280b1591, 0x0ee79fd24fb95bae,
+      0x8d58ba934274c6ff, 0xb5023cd7ec7babdf, 0x589699f615df907d, 0x1a8e89402e89c0bc,
+    },
+    {
+      0x024966cb928ac29d, 0x9c7b543a48449fbb, 0x9b227564ab2b7ffe, 0x2f0394ac5a305eef,
+      0x0607de374db68b28, 0xef99365b913d970a, 0xfa33c82830298a7d, 0x146c0cc2836fa053,
+    },
+    {
+      0xd5538f6cd56674de, 0x4b9f5625d958fb59, 0x6464df73b15d0cb6, 0x03b089b1a2066d5e,
+      0x8b1937f9bff40f53, 0x3ca49ed3a415c76b, 0x3772e3fc4fcbb816, 0x15ceb527d834a5cc,
+    },
+  },
+  {
+    {
+      0xfb3267b34be6dca8, 0x77c02b18fc5a5aa8, 0xa2702446e922237a, 0x244c91d9f1553a09,
+      0x193a74d62db41fe9, 0x5193ab1bead954ee, 0xc0d9cb50f3b585b1, 0x2e005fc2223c70d0,
+    },
+    {
+      0xac2fef1cd5df3d74, 0xdbd1a6f6f48535c3, 0xd0492494827494a1, 0x14df3b684f96c678,
+      0x9a15c456185e48a3, 0x08eb25d4b0c57b84, 0xe2bd6c44eae3b520, 0x0d67eed9c22a0a10,
+    },
+    {
+      0xa77be94323ecf7ce, 0x42a4fb97096f1b7e, 0x912f3c6f2d1d0148, 0x12ba786c7e99fafb,
+      0x6b05c32014b2c56b, 0x259f43f61b417cde, 0x723fd39a5c410d8f, 0x02a00428c7417b31,
+    },
+    {
+      0x38b70a60677c9bf8, 0xbdacb0136203a8ce, 0xa6425700c57236d3, 0x12e30cfecdc81ef6,
+      0x29295789fc65aa65, 0xded6f210129dc187, 0x72d09e666b5b33f1, 0x2b2620842a532855,
+    },
+    {
+      0x072510a5e6750769, 0x733de0217cb66703, 0x0c8681eb8ebdd430, 0x06127644f131647b,
+      0x7550c30d596cf3b1, 0x0fd8988208abc6f4, 0x4abae1beac725ca2, 0x236bb1e6146a4738,
+    },
+    {
+      0x6853cbc3db56a863, 0x3cac26826060ec23, 0xe2eab04f4ad320fe, 0x1ab88598d927e86c,
+      0xaa016292b712afd5, 0x086580496f698362, 0x13387d889f7a1045, 0x20a9a9e59b32225c,
+    },
+    {
+      0xd4ced1433bcb3970, 0x9b17070572ef1f21, 0xe621a511cb9df901, 0x1e8815a53d128be6,
+      0x636f5daf004d31c0, 0xca59f9452d7fe1c8, 0x48fbcf129ca064cb, 0x290097fec4ab2e98,
+    },
+    {
+      0x8efc8e3d95dba380, 0xe35fdc03301600ab, 0x90b7596c17a11544, 0x16f60a7e3f1b540b,
+      0xed9b3a469642025d, 0x513941dc437bd299, 0x179c1d38b51c30b0, 0x17a2e576c7e8ed7a,
+    },
+  },
+  {
+    {
+      0x874bb260035f6a22, 0x5fc733df7fa87428, 0x7bde098651a19599, 0x20c21332a9457005,
+      0xd0600555777334fd, 0x57bd43246f2de4e3, 0x40c1d32c10ecfb0d, 0x18e11949fc230a56,
+    },
+    {
+      0xee7eb4405e7f939f, 0xd38e6e94e3285625, 0x453d7e56dbdc39ba, 0x28a9a66628e968f5,
+      0xa7628ba935a3bf87, 0x82c8261dfb3cd937, 0xa481a8d9c4108e1d, 0x27c1579d1c68729b,
+    },
+    {
+      0xf0b5d8a5d65af74c, 0xd4a6ba37ff9cd4fb, 0x6687ccac19fc14a9, 0x07b6c774bdee13d7,
+      0xe85487ed4fdd93d1, 0xf754edf082596bc3, 0x8005dc8d6e679aba, 0x0b8f849b472d00d1,
+    },
+    {
+      0x8b10ceb8ba74c9db, 0x8e75dfa47579fec4, 0x2db242b0fd06637c, 0x264cd0be90bb1b57,
+      0xb6ac738b59ab13c3, 0x567fbd055bc38d5d, 0xa66b224ed882df0f, 0x305569e0e6583636,
+    },
+    {
+      0x574a4ac189d48530, 0x93a3aa3f751256a9, 0x0d042f34fee6e8d9, 0x03b5b2ef6e601883,
+      0x4ddf8d8212bce710, 0x079a13866f704c0d, 0x05d90f8aa2a73f30, 0x28ec5eee2f6272a9,
+    },
+    {
+      0xcfd937748056ac57, 0x568cddca6bc50987, 0x475722d36498e3ed, 0x09784308f412761d,
+      0xe110a50e620cb5c7, 0x016f71547ba8b107, 0xfd6a6f6e87b8c34f, 0x0897cf650dfbe351,
+    },
+    {
+      0x79741dc036d16a39, 0x6d4e0906f14995b6, 0x17f8b04e23f5c5c7, 0x1871458035c9809c,
+      0x2948023baca52df1, 0xe2f235843fe262a6, 0x467c52ad138dc08f, 0x0e490207ed7a7874,
+    },
+    {
+      0xa1bd92e126dc538d, 0x546b37c3371d8ad3, 0xa23b0b015449088e, 0x0378f10283c5997d,
+      0x2b0c025f0bc7aa5c, 0x25294b8fbe15d143, 0xb90adb96c734ee2d, 0x1cca5540ba7ec653,
+    },
+  },
+  {
+    {
+      0x4410d32a6a0a1fdd, 0x0d96e57038c88d31, 0xcaf032023c6220e6, 0x303dcd94800bb7c0,
+      0xf5f7bf88f310f0e4, 0xb5c6d2d28f1991ca, 0x51ab29de3286c600, 0x0efbbe419b92f89f,
+    },
+    {
+      0xd36f34f5879c8d87, 0x976c7ecc8da741f0, 0x7f5d51c5fd15b8c5, 0x0e747422e84218af,
+      0x033c68a114192710, 0xe6c8a97f9ea025dd, 0x7ff6f6d7ccfdc51f, 0x05a266088c67d7f6,
+    },
+    {
+      0x9b4da7597873de9d, 0xb9903e9ce99915e1, 0x1ba34655a02923d4, 0x1a8aee2159a9949d,
+      0xa6c992ac3bc03028, 0x115b8286bf23649e, 0x1a8da000665379f0, 0x1dc0a3a76d2a17bf,
+    },
+    {
+      0xe7aa6959135a16ba, 0xab19c5f6032a62ed, 0xb58742cf8fda3fa7, 0x29f5d48f01f512f8,
+      0x0bddb9439aad5735, 0xb80dac99697c9354, 0x2098ffbffbc8e3ca, 0x0afcca6dfbf9fc64,
+    },
+    {
+      0x390ff06aaaa95070, 0x39ef4f5ff8366100, 0xc12db9afafc460c2, 0x2ddc8849732a9d37,
+      0xe5d14627aa72e7a6, 0x5fe5550171e7c9cf, 0x5bd2d2da3efca254, 0x0065f1a38920082b,
+    },
+    {
+      0x65c1385ecd68d3e1, 0xda972b52c8081ae8, 0xa3d9fe34a0d487ce, 0x020104f5b6b128cb,
+      0x403aa6f952ee91b1, 0x93ef7a89ccae0896, 0xd996ae2bbac021c9, 0x1bc702019964e535,
+    },
+    {
+      0x8793e30b9a3b4862, 0xb5ce0d5e4f2aec18, 0xf9cecb1100600c00, 0x0091020328729fdf,
+      0x4cb2f8ecb076f686, 0x6bdf171a7694c276, 0x46c90804ce9b303b, 0x2ef465f3591a4112,
+    },
+    {
+      0x0f6c3de15bc0bfd5, 0x239621c3b0e22772, 0x93772a1d32e6e6e6, 0x07da58dda7f37491,
+      0xe9d17deb4a295f8b, 0x83c9bc269af9cfe2, 0x53835a29c03e404d, 0x200ee6d82e276672,
+    },
+  },
+  {
+    {
+      0x9307a647ff8c0b44, 0x16fe7b7a8b8e4997, 0xe01e1b0b646f29ed, 0x1975e7307e2b3ae0,
+      0x27f27e4f5cb29074, 0x0cf3b857c08ff4e7, 0x5e3f023d069c1740, 0x1cf8a0c8742f25b7,
+    },
+    {
+      0x023baf9be081206a, 0x88e339be91ed2b27, 0x482738776dd66b24, 0x0dfc508b360071df,
+      0x618f94d1fb2d535a, 0x6030fe3506aca598, 0x7be5e95ee8903384, 0x094bf568795046c0,
+    },
+    {
+      0xc8c1094004246f62, 0x3120d0b265145ae7, 0x82aa1336ea42d103, 0x1e4213610b62e639,
+      0x5335e27d6ef51e12, 0xc5333b687434e43e, 0xbf8fc4c50060d861, 0x17e6d1dda51f4ac9,
+    },
+    {
+      0x1f81437bc198a972, 0x4c092c65b4ca4698, 0x9c2dd818eb12eceb, 0x1ddbcdfe5c240b28,
+      0x5bae6fbe8b08924a, 0x429c82b79524162b, 0x9be512b484c14548, 0x2a91babeaee57e1b,
+    },
+    {
+      0x4b599ac715b00e1f, 0xaea0be85fd3fe796, 0x82b724e0f7af0f77, 0x136ad2dc5c24931c,
+      0x05ca66950b12a5a9, 0xa98f2b6979774f0e, 0x7647af97d7f8b049, 0x2521b76d6e0dea90,
+    },
+    {
+      0xb13089c56329da0e, 0x35d8b1fbba957705, 0x90df09417859c451, 0x28d80985be43ecd8,
+      0x8199c4214c3bcdb1, 0x83c475c6866c68e2, 0x570b16b79ebfa51f, 0x117d9de067a9346a,
+    },
+    {
+      0x8abc7da48eeff45f, 0x1b787145a7723f56, 0xc351898bc1984121, 0x171051cb3191847f,
+      0xacffa28491d7e419, 0xa755cc88c7c3f6f7, 0x4dbc9f5d8baac70f, 0x01553e7509f1aae4,
+    },
+    {
+      0x87b31ef9c2b7943e, 0x3341756a3d353771, 0x4c208f8d28ec9922, 0x0f205b4958b3428a,
+      0xde5138630f72579f, 0xaa121266afd44f16, 0x63bae2733a968f39, 0x086f5e7c57800ce0,
+    },
+  },
+  {
+    {
+      0x011c0f856ad6b8ec, 0x86214a4ae1479099, 0x39cdb5e015b1e414, 0x2add0bb8e1b51929,
+      0xfbaf845167746bc5, 0xe951367e532c0e0b, 0xae16fe4e59bfc9ea, 0x25a3f543ffdc8565,
+    },
+    {
+      0x5b1e0fc937f86b4e, 0x9f39e501b1b39a62, 0x10b1dfd740e9003a, 0x1bfc2bda38342fce,
+      0xdfab49ae134c9bbc, 0x72cc90297969042e, 0x68bbd6eb0feb8585, 0x087daf60d934e696,
+    },
+    {
+      0xfee4709f21e7b470, 0x76142f58f72cbd70, 0xcc08139a5542f409, 0x29458bca83f628a7,
+      0xfae5b3eebd7d4661, 0x33ac24f605416e39, 0xb249383930012355, 0x18a4dc11c99c48dc,
+    },
+    {
+      0x7bab22f38370e663, 0x187c303a905eeca0, 0xa199eabf872dd799, 0x2fc29cf10b178064,
+      0xfc1019fba6c7d685, 0xf8156b4112dc18d4, 0x5497787022eeda59, 0x2e6e00f97c83d008,
+    },
+    {
+      0x14e6d3ee8e663d78, 0xbd22ae9e1692e162, 0x8edd732e4c9ccef0, 0x020067c2bcb9b446,
+      0xe96a6227ab4b72ea, 0x15c585e7a81b0dc2, 0xce240e57ffbf9101, 0x259eafb1dec7ba68,
+    },
+    {
+      0xa3e52cc3acb676d6, 0x1d6818625abedca1, 0x829263836d65f825, 0x12aca3f4c3ba5481,
+      0x2c001ddf7f365e75, 0x1c56d29583e80f18, 0xe619e95f488908f7, 0x2778a405cfebd008,
+    },
+    {
+      0x4ea0ff52fde956fc, 0x542b9eff146d2aa7, 0xf1f33b918c544483, 0x0791dbaac6ed9e11,
+      0x89f932b7eda9510b, 0xf8256a436e56c0b9, 0xe8178a8a89705c37, 0x27f53fb290134c1e,
+    },
+    {
+      0x3d4847cf952acdda, 0x85c1902a90f9bf0f, 0x3813bc6960fd14c4, 0x089a75783654edc2,
+      0x5b4f11aef88be3ce, 0x1f2392a81dfb4c3e, 0x7ebae6ea44936d7d, 0x1ec3c34568ee50ca,
+    },
+  },
+  {
+    {
+      0x7429841cadaa35c0, 0x7f01cbad195c082d, 0x13b3b496a4a142e1, 0x1d16ff1b8e06089f,
+      0xf028ceb78b3f4816, 0xce0c1ba75633a340, 0x3b5e0c9148c85757, 0x0f5ac4e7f09809c5,
+    },
+    {
+      0xdbc566fef36e8003, 0xa1cbacb4ddc939f9, 0xc8132a2da67ca368, 0x137ee56bf64ecc66,
+      0xdeab33c8241cf103, 0x4205f41c1076e233, 0x51e65a08089ab495, 0x22941ac435b615e3,
+    },
+    {
+      0x1acf3d2dcba2687d, 0x4bde4b57291870e0, 0x58e8e845bf95381d, 0x2bf05f015a6593b0,
+      0x69476c9499f3c2b2, 0xc7859b859440111b, 0x776a1306a551e8a6, 0x0e5459e6b0158278,
+    },
+    {
+      0xc584ab02e8ee5f61, 0xaee0b44337f52fe8, 0x4e3df8554e5b9a88, 0x230095616b1ca44d,
+      0x02a0c4082e40132b, 0xad0a2a31b4b0de08, 0x5dbcc7585f1ad5dd, 0x21a0956fbe98f21d,
+    },
+    {
+      0x25ccaeba3cffec00, 0x6ef628bc2a62c568, 0xdeddb5f09d615780, 0x10af6faa599e5f09,
+      0x7ddd402e71e2ddb2, 0x64a5bd1122718b6a, 0xef10d1aa7d05e733, 0x2558e4305ab44b23,
+    },
+    {
+      0x662ed8171c0186d0, 0xcbd73b13fec0b436, 0x2050808289658aa9, 0x08c72d3dda09d7c9,
+      0x127c3dcbd4fa81ad, 0x2d90fe8f6ff04d4d, 0x994cb48f028465d8, 0x22343478d2ed37b2,
+    },
+    {
+      0x2b09149253ddf5fe, 0x61cd6c6bdaa683c8, 0x98dbc7e2c36f62a1, 0x2f85b79d1137e5e4,
+      0xf0ff1287eb71c547, 0xcdbbd3acb40aeb3c, 0x5bc0d6a50e4bceb5, 0x131b00ab0ee4681c,
+    },
+    {
+      0x64336e93f0bb6f41, 0xc9493b432abc49fd, 0xe1cfff74597c288d, 0x210d43f5834dcda1,
+      0x50bf15e3fe25de1b, 0xa239ef3b01dea853, 0x1dfc43b5f08a0fc5, 0x2d06bed3cb100612,
+    },
+  },
+  {
+    {
+      0x8892072a71b20a0c, 0xc2236c3f728df8b5, 0x766ed89037ff0d32, 0x2a8b581c4eabb963,
+      0x341458771ce39aa2, 0x5ade1cbd84bd0a5e, 0x88a92a51d608a945, 0x284d04164785767c,
+    },
+    {
+      0xd70ad9460fc5041c, 0xc235f7f056906caa, 0x896865d2bad053fb, 0x2cc8a30bd96c7136,
+      0x130ffab8f17357d1, 0xb4745e77242e2450, 0xa654708381151d41, 0x29751e1b147adc7a,
+    },
+    {
+      0xc30a81815704f430, 0xb8f4134c11ba271f, 0xa8fbc500181a7f8a, 0x0a05f409efc79a9e,
+      0xc1173d27d0ba5f5d, 0x120805fb52bd354b, 0x8b514ab9a6d1f39e, 0x2a4a6affb4045404,
+    },
+    {
+      0x7fa7efcd4bc1e5e1, 0xc18934645a33afbf, 0x8d8ebb61c81a8e77, 0x11ea27bfb7f03fb9,
+      0x0378cb4e85d839b3, 0x204c1354b177b215, 0xf59c2a1c3a624e55, 0x19a7cba26e0aba86,
+    },
+    {
+      0x655daf58c053158f, 0x41e76a1958be5401, 0xbb426493d3534fef, 0x16a022f40697c626,
+      0xa2e902a04b4b07fe, 0xa432acd0b72f9c06, 0x62bd0deb52fdbe40, 0x16011ea357a3f430,
+    },
+    {
+      0x0cb99d1df803a8c5, 0x8cb794718cf8e392, 0xb875dda266e50b0e, 0x294e926243c6a46f,
+      0xb7743b7428672eff, 0x4ded208e2e93e417, 0xa873f39ba0f36c7f, 0x00f84f6c11efa471,
+    },
+    {
+      0x3da9ebbd2155510e, 0xa2836d50c3cb1e3a, 0x8c56dda99dbafedb, 0x23d01206fc852e8b,
+      0x30c24e1618a5c3de, 0x6058740a3983378f, 0x3d57d21c08a08e0d, 0x033739053a859603,
+    },
+    {
+      0x705fb22c3ad0d6e2, 0x95d128ed3b0b7332, 0x994bbee72a3c42d1, 0x1d8f5da75d96fa1e,
+      0x890ce0a0584db04b, 0x13f3b7fba74fd3d9, 0x1c8c0a6064e71a91, 0x10300e9af1c4a764,
+    },
+  },
+  {
+    {
+      0xe2e779d80cce77cd, 0x0200e259ed27ea44, 0xeef4bc6b42292cd3, 0x2214206011c5fcdf,
+      0xd534955190b84725, 0x1b0145dda4c2e611, 0xe1a4c0a8868c2d3c, 0x0188430903c013da,
+    },
+    {
+      0xfdbcf05e619cad47, 0x0cd735356ecee934, 0xf415dce45c516e13, 0x2d6ae087b1f5d099,
+      0xfe571667be896ebf, 0x07868c7d42f509b2, 0x721e8b3356f7c50e, 0x16a39b41d2b2671d,
+    },
+    {
+      0xc14277145d984c05, 0x73e25cbe8e70f02b, 0x7c9575694d7b951c, 0x083a78ff2201fcbb,
+      0x6762d9e8e5c8dfc4, 0x87b0d30e74bdbaf3, 0xdb857726dfe8d878, 0x2d5da5de3d94ac99,
+    },
+    {
+      0x264d4c1a1a48467a, 0xeb8aedc70403978b, 0x786df698ddb4ad1c, 0x227727be668c1fbd,
+      0xa71d4c7d64f33d08, 0xe28a31e307ac9dc8, 0x2b290f1984fe5a4d, 0x1294d0833badd029,
+    },
+    {
+      0x3a45504e928eb094, 0x4c058fd9afe19300, 0xa0cfde532a33d8a0, 0x2d42d79a0346e109,
+      0xd78c660f632b6cd5, 0xde42bc07ba39b875, 0xa122c582c2998696, 0x25fba8c2abd3d1cd,
+    },
+    {
+      0xc4b0bc5548224122, 0x44908b8dc7a80f76, 0x14fc7f332622a802, 0x04aff49911b4bf0f,
+      0x2800811a01c6b6a7, 0x1de4b88987a8c188, 0x2c3616a53c499a93, 0x09b2eb66a93c38a7,
+    },
+    {
+      0x544f7b33551f04e3, 0xc6e891bb66bb6903, 0x62015e03d6beba58, 0x1ceec8d4c738e731,
+      0x476e8e80e7bbe348, 0x51ab0b79eaced42b, 0x2a01bf2b30a7a8b3, 0x1bdb46b62ac86a58,
+    },
+    {
+      0x927bb52db41886cd, 0x7222db13cd737bb3, 0x346afcdf39cec6e1, 0x215a99e60da4410a,
+      0x04578edec769a83f, 0x7333280f2c08e0b4, 0xdf7c601c11bd5c6f, 0x289958065e9b61fa,
+    },
+  },
+  {
+    {
+      0x8f9f69485c61ab52, 0xdd8abf9f6193809c, 0xecf1cad8d0f899c7, 0x1d1e0eca57ffa0c4,
+      0xaa2e7fb547ced0a7, 0x5da319a81187277d, 0xe5d3040d0aa9a9a8, 0x28c81221f7fe1f4e,
+    },
+    {
+      0x8609d9d4ea83b16a, 0xf5b6801040598a3d, 0x4649b5b5851644f2, 0x26df4c5a6d79e299,
+      0x5487e19f28383b92, 0xd4a481b15462379a, 0xa6c673b06c5fbd47, 0x26d6c8f991c9e881,
+    },
+    {
+      0x3675141b078d5d0a, 0xd9f9743582ab1238, 0xae842c2c6f1cb92a, 0x0052fe508d453d86,
+      0xbe1cd09404462225, 0xe289301f112df498, 0x00d322098b4326c8, 0x1d303c7b5bcd6a8c,
+    },
+    {
+      0xe7f26dc845485d3d, 0x7d5039144177946e, 0x63fe36ab4d156923, 0x1d236625f7933c99,
+      0xc15f4fc41827997f, 0x7f0d36879d73e359, 0x68f8894be99f61c0, 0x1e192869dc59742e,
+    },
+    {
+      0x460a53387aae73ca, 0xfbb1d6952530592a, 0x2a019bd007df1db3, 0x03e4087878013479,
+      0xf070fb85fdc93a24, 0xe5c4d0e5ca92dec2, 0x3cee9ca1929c1661, 0x2dd79eb56cf45ccb,
+    },
+    {
+      0x7eb0b1e061fd7ebf, 0xb84e4f61b48b86f0, 0x387292f8cbe4e7d7, 0x067344d84e9c2ea2,
+      0xd9fdadc2820a8a36, 0x8d47f46c6966ae67, 0x0886f807ee607a37, 0x18b451ca4fbbd565,
+    },
+    {
+      0xdae36ac5b8fdb896, 0x1bcf14f10d915503, 0x9bdaecb7eaded874, 0x2ce675e92111f784,
+      0x1de92917a336dd37, 0xd09fd70e453d7b43, 0x82893ae56aeb3a18, 0x048729968560b5b7,
+    },
+    {
+      0xc77e6134b521d465, 0x6f3764d66c677545, 0x43dab5b2005a627d, 0x01b7b7631fe2bd71,
+      0x629977982e2a78da, 0x2a9d30e3fda00c64, 0x1b4c4c9a6e9077c2, 0x23b8c55eadee46b9,
+    },
+  },
+  {
+    {
+      0x903572e9f22b166d, 0x760963d37336ebe9, 0x8b464b6092f4db83, 0x1797bd206e48fb48,
+      0x2d394d0f83264a41, 0x14786b04a80c605f, 0x9c51ff8929980926, 0x2cee22b8711f009a,
+    },
+    {
+      0x5c598e7635808d47, 0xae270b06a73a2448, 0x2e5dcb8530417069, 0x0d13a34c6697c5c3,
+      0x4c156b35569322a9, 0xe011caef9b9eade8, 0xc34f2d720b4ecd00, 0x2950ca0f22b724bb,
+    },
+    {
+      0x0e4cc748395f92e0, 0xdf81796c643b6cf1, 0xf557f333ea65783f, 0x0aec6950a338cc23,
+      0x516b809bdfba26c0, 0x30be32ed4a0a99df, 0x47273691aeefc46b, 0x1bc2941b97df4361,
+    },
+    {
+      0x960806d887698db3, 0x1efc2e73741a8da0, 0xc7399616207c01a8, 0x012e736d3781319c,
+      0x3163a3a71fdf4e18, 0x024fe3efdcd56353, 0x8e49436051d723ea, 0x115907ab6c90d833,
+    },
+    {
+      0xea6f7e12dbcfb268, 0x46f35d8ed8fa5753, 0xf44afcd6f9bed2d7, 0x23d1e10f320bf200,
+      0xadfc0dcc47cb6300, 0xa9ece61014de3369, 0x2744ed659d3c4223, 0x01cb4b2fee1e224f,
+    },
+    {
+      0x908b5ccfe40783da, 0x03f6ed6d21378257, 0xcc7b05ba07a8c64c, 0x02c9d756bcffe75b,
+      0x6fff7bc84cec6331, 0x64415a4bded9283e, 0x914d6d1cfb1b3f6c, 0x1bc8d7207f3de939,
+    },
+    {
+      0xe9245d0c9b94c62d, 0xeacb952fb09ca820, 0xd130825183e92311, 0x24316a615b677e80,
+      0x8937587e2d1934ed, 0xf9d12d04193d5c85, 0x63974bb40bf471d0, 0x1ff0bba42486d16f,
+    },
+    {
+      0xf5979dd9ddc8291f, 0xe41430cbd1d96856, 0xe74fbfb9d4ecc8a5, 0x1285d1aeef5783c8,
+      0x17ad7ee8648f95f3, 0x286afe90f224a45b, 0x12aac7a169d80e49, 0x1f6ba2108b5f00d6,
+    },
+  },
+  {
+    {
+      0xcab23dfee44f3071, 0xa2892ceba1506ca2, 0x8e1bce74c00860f6, 0x06fd1c8c588e04a5,
+      0xb9edb1493ad5eef1, 0xeb5407638507414c, 0xae59a7727a0bc059, 0x2c050a80896c0b3a,
+    },
+    {
+      0xe401d58f99ffa52b, 0xa41a0dfee62504a4, 0xeab6281db6e51629, 0x0f49f6227def5eea,
+      0xa82ceafdd2a25670, 0xe85d0a88080327f0, 0x07b8cc6f068a47c7, 0x15c9a5fd66ded9b2,
+    },
+    {
+      0xdbe0cfd5076a03ff, 0xac8c24b8d94d1952, 0x6e0cbadc087a52bb, 0x06359484a0acbadf,
+      0xab9ae9cd8419119a, 0xcec2eadacc2284b4, 0x2afd54d09fa579ab, 0x0589a526cdb6b0dc,
+    },
+    {
+      0x3ab3482817c2538f, 0x6c71a1a17d64f47e, 0xe0a0d349439ad5ec, 0x18642a6fd951545c,
+      0xe106b887d9f22936, 0x402c331d5fc2e4d3, 0x0cfb11c09b98cf66, 0x21035428f1db1bd0,
+    },
+    {
+      0x4c359177cefccdab, 0xa9dee4a1626b22b2, 0x449e84060c22fbcb, 0x17e4bb18b67eb72b,
+      0xab4285e025aec4b7, 0x989117732d10a362, 0x197e3681befe6ac6, 0x085e9e89482888fe,
+    },
+    {
+      0x21e3bb62629f644b, 0x8eff5ad26ea31cba, 0x5337dac244488537, 0x2eca6661905b678c,
+      0xd17f72612d31d4cf, 0x5e26fecc4363878f, 0xad6d76e5c650a6cd, 0x2e1230e5271542d0,
+    },
+    {
+      0xe922318f7ef91e75, 0x2030630f1e7263ab, 0x1d1dfe20099acfee, 0x1b00d644e3c809e9,
+      0xca14ae484ed22579, 0xa9ddeca30c5bed2e, 0x38d38196328fc106, 0x0a4525604abe6921,
+    },
+    {
+      0x8a7f57c75dce0ba3, 0xa46fa2c53d8b8033, 0xa79813f93fdd907e, 0x2b1d84fa6edf53b4,
+      0xc60fe91fd2fd47ed, 0x9cc4d09bde5626d0, 0x54db78f2db46e991, 0x0642c1686677bb62,
+    },
+  },
+  {
+    {
+      0x4e321323603ae2aa, 0x3842cbd631217176, 0x763cef092c52f158, 0x0115de7e671daa64,
+      0x1cb79e851e1b6080, 0xf015b1e36366dca4, 0xbd43fa643157a691, 0x14e71b45570913bd,
+    },
+    {
+      0x88a64e7810d6f4d8, 0xe43885cb093b6bf4, 0x35a1eb65e8366f24, 0x2ba7647846742a93,
+      0x63bfdc4c0b7df4b4, 0xb57ea2072a0f1632, 0x816ffb243aa9d44c, 0x2f6cffa37d6a4031,
+    },
+    {
+      0x1c4874e9e869d92c, 0x3f83f55773e29f66, 0x795a6a9b509ef3ba, 0x15e5fd353f08f71a,
+      0xc7fe872455610172, 0xefd7b5c533331d6b, 0xd8fd0224d48266cc, 0x00a450bd1f795dfc,
+    },
+    {
+      0xc6d91e4f3839d676, 0xc4698d5035e31e16, 0x15d6778a2c1066eb, 0x28382d11538eaefc,
+      0xd1f81bb00147c32b, 0x38f92afc4e37cedb, 0xf6e15830c77bcb82, 0x082fce270e3cd9db,
+    },
+    {
+      0x7efcb921c68134fa, 0x0a86180423c299fe, 0xb474c91e7319f445, 0x2b6a1f9f4c63d222,
+      0x1f2069e4d569589e, 0x3daf366d1b23b9d7, 0x2d4b801e6c130887, 0x127d4a70487f5723,
+    },
+    {
+      0xa4ea5d291854f6c6, 0xcc984223e761569e, 0x9548c3e0daa3385b, 0x26e34dd08ad9f0d5,
+      0x410bfd1d28422437, 0x8ead1e502320f830, 0x9433f129da4a6e58, 0x068296f42764315c,
+    },
+    {
+      0xfa9b5849cf8183dc, 0xb2aa01accdf49947, 0xff1ef4e33e302db7, 0x04cb65df6c26d5da,
+      0x62cbdf66ff341c81, 0x564bd642523de6c5, 0x4ff4d2dee8614de9, 0x10d64a75cbd8acf7,
+    },
+    {
+      0xa66d7a503a84eead, 0x00aa9c46b809a1a8, 0xdedff4b616841675, 0x078a32de13108e6b,
+      0x6109a40372201594, 0xd649ca8d347e9e7b, 0x7dbe889cf231f27e, 0x2341349c19b83b46,
+    },
+  },
+  {
+    {
+      0xe91790b216405bcf, 0x7cba2dbeca25e70c, 0x484a1b466edda981, 0x2e91aaa5c76c9d45,
+      0x7f3df8536141f82b, 0xc6190153ee8033b0, 0x8dd247ef4b2007be, 0x2d1c243f036065e1,
+    },
+    {
+      0x1d556b0eb107efae, 0x4a49af41f9d10e1d, 0x9205cfb87b5c5bec, 0x12f495853cc56a21,
+      0xbb5fe1c5a14b69aa, 0xf1fe58cdd5430f59, 0x09d728af5841e809, 0x0dfe6676b60be6ed,
+    },
+    {
+      0xd1324d15b82dadfc, 0xbe6190ba307d48ee, 0xb63640ea3ce60bdb, 0x0632b8a726a8d8b0,
+      0x9d69e32bb5e44e15, 0x6dc4dd82cfe986a6, 0x33d2b28607ab90d4, 0x16d5977b194fabf6,
+    },
+    {
+      0xb0a7ba25a3530fa8, 0x54b02812cf682f8e, 0x461557e05d1c98ce, 0x2e9884613765d93f,
+      0x6d6ade8501515f7b, 0x27d48bad9e5f8ef6, 0x6076d20d1b09aa47, 0x22e3ec8ce86f0ab7,
+    },
+    {
+      0x7c7c8191f704693a, 0x8f7a41e4b4840147, 0xda710bc9735332c6, 0x29c6f796dc4ab4b9,
+      0x05bbcdec2fe1e4ee, 0x1e5021739dd21025, 0x45a4e59d5bb234c9, 0x22cdcf128cb4a3d8,
+    },
+    {
+      0x521f41443fb80388, 0xda0ca90a5c8376ee, 0x497f78e625ce991d, 0x278c8cdbc0deed5f,
+      0xf20a8bf7dce0be09, 0x928b018a547d4468, 0x71faebbb6d995bea, 0x2c2d4e929ef77394,
+    },
+    {
+      0xfa0b653b8eb29948, 0xe7811cfa9a1be700, 0x17f7c98bc2536882, 0x000ef9866c62cec6,
+      0xf5a00e65146d3ebf, 0x10b5cf430a61e530, 0x2d2186eab9bb0edf, 0x012bac0c19289525,
+    },
+    {
+      0xe19ddce32e325740, 0xaef11344ba069a8c, 0xc808d34b1c62a530, 0x03d7939fd1264fb9,
+      0x8b1133012af74895, 0xc8d02ba492fa45d1, 0x6eb0a5a15c5c674f, 0x30346b7a93eddcc5,
+    },
+  },
+  {
+    {
+      0x3ff0bdc25e55068c, 0xdb368cccea44e810, 0x1b0450224de9f2d2, 0x063d54374fd35631,
+      0x3f823b51ad71a117, 0xeefc439bbd9eece0, 0x01084aa6022731b2, 0x084038142e71d09f,
+    },
+    {
+      0x41e910f21aec678d, 0x80c792b3bc8f6806, 0x3fddffa046056e33, 0x165c58bbb239672f,
+      0xa9c24c39782fe33f, 0x808089a32c330fca, 0xe3660e3c7f70d9de, 0x0c917898c61d11d2,
+    },
+    {
+      0xbf8b94dfdb23a312, 0x13ce159826156005, 0xb8beb0db7e795040, 0x06bd668bb81be573,
+      0x6555d42e20c60d1f, 0x7aba957f571b53ba, 0xdcf80b4f3e540659, 0x0a64aad941c2ea9a,
+    },
+    {
+      0xb62f58000a6a1e42, 0x2b2687bfbbdc38d1, 0x45304dbbeb744969, 0x242b46d6be9227d3,
+      0x7136b40082655374, 0x5da56bca507cc40c, 0xfa3bd9d575d6df2a, 0x23e7158c84e483bf,
+    },
+    {
+      0x71e354b1bfdc88d7, 0x17d98bc7bc735d87, 0x7858f940517f36d9, 0x030e376d531ca94a,
+      0x4e6e3e7491c262d4, 0x13ac47d41c21e53d, 0x6a7184d27a3e4e77, 0x08d1fb4ca0283c53,
+    },
+    {
+      0x5a00e1c507b2fe49, 0x91235d5f99c4861d, 0xb18721aa6d714c64, 0x04642fea49429244,
+      0xb8c3793f72f12506, 0xb743c560a92168bb, 0xebab5e954ada2641, 0x01ef4dc23f17f4ee,
+    },
+    {
+      0xd72102796bb1aec3, 0xf43ae33da44cbac2, 0x14bd1b1477a18f7f, 0x10f4367dc640c76a,
+      0xa939826a3ec05ecd, 0xd66374289cc82fb7, 0x57eb2c1ba5edd12b, 0x04e1c32a71fe1266,
+    },
+    {
+      0x64958b93444210e0, 0xa3f4f18d322d3e32, 0xc82058eeee54194c, 0x2a340855f16f21b0,
+      0x95d5b8903f3276af, 0x804edf4f554e0d4e, 0x91d133dab2e4c5d3, 0x16ff0a44603f8bec,
+    },
+  },
+  {
+    {
+      0xffaef9c95a49e76a, 0xe1e5422ee5d08d14, 0xd63152295164bab5, 0x014e2f4a5cd5f740,
+      0xecf15a3521e58c22, 0xd68097829a4decd3, 0x8225dfddddbc6768, 0x134791ca74bcbf78,
+    },
+    {
+      0x3e6bfd153167986a, 0x3b7d18dba7c13f97, 0x05ae509aa1567927, 0x11f7772f5333304a,
+      0xa90b5a442abb2adc, 0xb624a94a0dcb45a9, 0x77549f13cfe0141d, 0x23f66688b8346976,
+    },
+    {
+      0x88bb23ec0c5888bd, 0xb5bca9140a12f3a2, 0xeb6c8254d62bb658, 0x1faa82ae122f5f84,
+      0x9bfb0d88de66c4b1, 0xa8ffbfdf4c2820a6, 0x4eb8813b8b4200c1, 0x1aca6d201253f401,
+    },
+    {
+      0x65525f9b29afe45c, 0xea736ab1b1e5fe34, 0x25a0ff01803b07a4, 0x28fb430872e5dd8e,
+      0x9375ece6d682744c, 0xc24b8a812127f330, 0xe20747fc200c1af9, 0x189e1d0b04b49489,
+    },
+    {
+      0x12ececdd7721d5c2, 0xb1ebf806cc8242e2, 0x3c869e6f81eafe07, 0x17f66fc6b0666234,
+      0x02619744470ac54b, 0xea047dac9c1cfa05, 0xa3e5213e898db0fb, 0x191af5c53c69a4db,
+    },
+    {
+      0xeaac2e068d905cea, 0x881c47fa0f9a2cc2, 0xd689c2f277c46a62, 0x08abef4094671174,
+      0xc8ccea790f8cb9a6, 0x45b008116d8e7a4f, 0xe3071cac1c153a98, 0x2f631df85a8a6c8f,
+    },
+    {
+      0x930d0ff383be7208, 0xd55b7f4faaef18c9, 0x60fd9f33f71bd95e, 0x27afa1d375853a46,
+      0x704b1cce5798e754, 0x6fb9f23880bf9268, 0xcf74b09bdff9995d, 0x232130777380804f,
+    },
+    {
+      0x4a81c1d2305703f5, 0x254729e1de1a5f29, 0x245f835d13394656, 0x2b358d2ba3439ca0,
+      0xfd39291fa437a2ec, 0xb03e8c42d3555bd3, 0xb356671763362493, 0x27b13f95f3db3d3c,
+    },
+  },
+  {
+    {
+      0x3bd94f61708a78fc, 0xb7d3a1ebe7c7cdfa, 0xdb06fee2b840780c, 0x1779b7edb34dc04b,
+      0xff712cabcb12723e, 0x083dcac293a21c6e, 0xf98b6a4b485bff73, 0x2de0a594bc31e749,
+    },
+    {
+      0x2d8b2385d30e9776, 0xf1a92a2372224839, 0x0811c295e5e73970, 0x0935c3f3b47d8ec4,
+      0xdfa735245ed4ef47, 0xe236f822c5109fd0, 0x27ed9b2768d3fe07, 0x12d47943aacfbf36,
+    },
+    {
+      0x50b89f73eff8a2ff, 0x0199f5bb1f93a96d, 0x97602463e6a829ae, 0x1e3525cb58220b98,
+      0x62fd353f8604d73a, 0x18a8cd3cbb14229b, 0xc7f7f95622790ba0, 0x2fa48caded7d4c3e,
+    },
+    {
+      0x604adc64f2f9eba4, 0x9f2c1c7497f83334, 0xa2da902422bae40e, 0x176d33e2af6a9891,
+      0x5107ee5fa18f0182, 0x57273bedd0ece33a, 0x4acde5f159e86b5a, 0x2d8a5514239a054d,
+    },
+    {
+      0x655cdab472453958, 0x176de7456c2c07b4, 0x66aa41996e0a0e75, 0x247d05f7b052f645,
+      0x9bfa752406cf3880, 0x2b96e00dedc1d4d8, 0x1a2f0eff752afab9, 0x21f0bc78e619aa51,
+    },
+    {
+      0xc494be80cdf66bab, 0x02d2962d72553c22, 0xd301f3df4ac82d6c, 0x1efbfa33342f83dc,
+      0xb1c697ab21fa51aa, 0x494a41b022bf5636, 0x7f54815271a7875d, 0x0dd71d36bfdf9c99,
+    },
+    {
+      0x4224bdbbd66909f1, 0x05057287853392ef, 0xc29ef1efdc0d5f79, 0x20e4d21d09b47272,
+      0x94b5dc8a59e3b9b4, 0x9f6bf62dfb04e506, 0x9cfebeddae03f7a3, 0x09467da580d1681d,
+    },
+    {
+      0xc06349bcf2a66fbc, 0x76d4e5acb16fd3f5, 0xd50e78e439ecf345, 0x08b8ce4b1a39e6cb,
+      0x94cfe71c194db37f, 0x775acfdec22b9f33, 0x542990d442cc68ec, 0x24477bd1536e106d,
+    },
+  },
+  {
+    {
+      0xb917aaebfe224a2e, 0xae7b0132dc8a9c73, 0x487ce9baedae26ce, 0x094d30f51cea81b2,
+      0x45e23e8d5c70c7d7, 0x418ba9a738c48ad4, 0x030bf95e93bcdda4, 0x1b8bb77b589ca152,
+    },
+    {
+      0x1b0c0e73ca1133d2, 0x2c066d1380772523, 0x8a70cb5a5f9f0d9b, 0x082cd8c94ab89809,
+      0x2fbc7052e8ca4ced, 0x3da38b433386a726, 0xe39b2b05a30ad1ef, 0x20ab666cf694b575,
+    },
+    {
+      0x83ae25031e9b4cf5, 0x569624c6a7a3d094, 0xf7d4202ab2cc6c35, 0x1918c185fbae1728,
+      0xde4ee18b5256288e, 0xa3c3a9bfbde39ca4, 0xacdbf3f0f1b2071a, 0x3009a7dec09b629c,
+    },
+    {
+      0x9aac6ec53375e585, 0xb049ed318fa23c7b, 0x9f3fa4700d021080, 0x29f4685dca4d58fd,
+      0x31f814268bcafbec, 0x4cb44f6b979fffc7, 0xdf304c2c46ea31a4, 0x041ed2c658284cc5,
+    },
+    {
+      0x93b2d4c193ce5b62, 0x20bafafb646bf9b2, 0x44a2af1c19e2afb0, 0x0538d4e97e78e360,
+      0x85ccb21ee5b6532d, 0x460469af43918cb1, 0x543ec73fdd8d25d9, 0x1cb54570c06f44e5,
+    },
+    {
+      0x3d8bccbd30bf3425, 0xc18ddf4aeac5c087, 0x988275c51aa4285b, 0x0e407ed5734d71af,
+      0x05e54e6d19d3c4bb, 0x9b2045a3c9c0a448, 0x03527376d25e90d3, 0x2f29f28e165b06ff,
+    },
+    {
+      0xc980773c53754cc7, 0xae30385033cda490, 0x6a47c0f0ccbb4b7d, 0x23d58d37040b5b65,
+      0x8528f195c9bba4a3, 0x9b7cf3e649b05679, 0x293a9687db9db78b, 0x2e287b89dce4b23e,
+    },
+    {
+      0x2bdb81671ee5e18a, 0x8126790fbb91ef48, 0x80b48a5698979b88, 0x2c5f7b67c3f76c16,
+      0xd244daa47bc671a7, 0xb53a5899b823be22, 0xf784f055a6d81d7a, 0x23463a0b554ec3c6,
+    },
+  },
+  {
+    {
+      0x45235bd2ac1278d9, 0xcbf4569fbb26594a, 0xbc0bce0941e3d23f, 0x2bc529b153958850,
+      0xa4415ecf98d820c4, 0x5bcb725f4b42f290, 0x6fe18dd009655104, 0x15f16d3437ecb8ac,
+    },
+    {
+      0xb5946046838d8d39, 0x95f5921c3ca6ee18, 0x72cf46f514786d26, 0x2ddeb8a6ba39dc2f,
+      0xefa6fd3001a1f256, 0x437b75722fc4ac35, 0xadc9b7ca6754806d, 0x09c36e9423c888a4,
+    },
+    {
+      0x449e6c10326f8cc1, 0x549277742c5f8389, 0x548836f759087889, 0x2b863cd576adde52,
+      0xd6348bf277129347, 0x7b1beb985be2ae5a, 0xb724413c6dd2a329, 0x0cf9f40ebd2883ed,
+    },
+    {
+      0x16deef92f6ad845e, 0x15eb5aafb9bb9437, 0x8a99e18ab91045c6, 0x10147b8fd094c85e,
+      0x26f7264b1b5858c4, 0xc3bbcb6f5cdda3e4, 0x4ea821ed3729caec, 0x27272877baa428dc,
+    },
+    {
+      0x8f39e4ea00cbd524, 0x004560dead8669ae, 0xb8b0a810fda38564, 0x05fef640aa95ff18,
+      0x40d82925ecf2cd90, 0x2b432a243bf4a537, 0xb0c7150a1862ea58, 0x2cac0e0e3c383a50,
+    },
+    {
+      0x2953eaf13f20634d, 0xc3d0d13d034a347e, 0x0582c1c6a9289727, 0x16241f38871bd9c9,
+      0x5f866f3f4b818d2e, 0x12b2cf60b3e5b8a9, 0x84e816580a461f5d, 0x06e9286142c3cab2,
+    },
+    {
+      0x1e0025174af552ab, 0x773a87188b9fd776, 0xd7274e6d550f5bb3, 0x16bde72f1674b3ab,
+      0xd6a99082bd38076b, 0xb3baa00a25221832, 0x25a9346bf17c56db, 0x2ab8396eed0e0bc4,
+    },
+    {
+      0x125f87d4e6aa3161, 0x9a18fdbac3de9162, 0x26ad1d09cfa80e9b, 0x2d03a166850ff59f,
+      0x885dd768ac7c8dde, 0xa822b9b10a8067b0, 0x02a7e409ea1afb8e, 0x0e4ba984b5350102,
+    },
+  },
+  {
+    {
+      0x3a0f61378e61f0b2, 0x9c8766fcd2d24df7, 0x2fef8ac15cee57ca, 0x108deaa4166c4b3d,
+      0x9ba8f1f9823d2025, 0xcd233ef299a893d9, 0xc140e078b66888a7, 0x05c77ce56ccf5624,
+    },
+    {
+      0xb5c87402a6772d5f, 0x1d3558d41f7e0444, 0xa8cfe56405cd23fa, 0x1f0fc3d8dc152302,
+      0xfddab55c9eeb9346, 0x2076cd23151785cf, 0xbd7153c603999781, 0x03e52a535a517886,
+    },
+    {
+      0x7205a80ce210a12c, 0x3f42ebd47c0aea8a, 0xfa2b170b5b1e2802, 0x2f525fc534c77104,
+      0xfbebd83bfd06c7d7, 0x0b31d90d1d873551, 0xf913bdc596296ad0, 0x174a6e023e3f670d,
+    },
+    {
+      0x3740a1f1b948fdc2, 0x99fa4b33caa88e81, 0x1da1151d77d7bd64, 0x2088758e465f737b,
+      0x1d08a5c6a0f4da92, 0x92c3e0d4458f71a4, 0x784ba9229cebbba3, 0x172365b726bf4b7e,
+    },
+    {
+      0xe57a868a9175457f, 0x747857c7069f279d, 0x74c977694f7576cb, 0x1e63850625448804,
+      0x77317db717ae63d8, 0xf2d4742573b0be86, 0x0306e6d9a841d952, 0x0048268baebe162e,
+    },
+    {
+      0xcd9e4b3d3f2fe346, 0xff2f0a89547631e7, 0x7cd53f6f7c5c8ed6, 0x218b3d8021560342,
+      0xab63178d2514ef51, 0x172b5f011ff92f7f, 0xaaa21dfc3e394bf3, 0x031a64ce845a6790,
+    },
+    {
+      0xd7d8e4069be21211, 0xc39d7ce199632fc6, 0x549e4635fe02bf09, 0x281f74deb568b459,
+      0x4e3198e2ef4731ae, 0x843f4725300c66bc, 0xcae8d0cd142e0d56, 0x25e2ea1d59d60be8,
+    },
+    {
+      0x8b61b3aee9e9dcc0, 0x94b22fa50720964f, 0x527cef1a1938c9c1, 0x13b19f1c92ffcf02,
+      0xae3d02202605c75a, 0x30ad9db6366c24c7, 0x991552e1f9db0c9d, 0x248bc78439b745ed,
+    },
+  },
+  {
+    {
+      0xa618bb89ad5115de, 0x8813b98c8c61a40e, 0x9d0ea60ee51b8047, 0x2ba6020cfd72bc74,
+      0x5a36f23772d03f6b, 0x7e41f8de55436649, 0x07c2304eb8a6ae75, 0x03f5abae953fdab8,
+    },
+    {
+      0xcd7e24b63bb5ccbb, 0x8e512ab798f9593e, 0xd9e543cec60338a5, 0x0cd37fb90fee77c6,
+      0x739fc6845a645fa9, 0x78e05c4e8538be66, 0xb4f89b7a8cc04ef8, 0x2eb86e6bb2edf074,
+    },
+    {
+      0xccba12094dd3dbaa, 0xa6a1276201bc1a47, 0x7fe741c5b0c47eb5, 0x13471863e93ec205,
+      0xb8c6db62e248827c, 0x1c861e71d212da1d, 0x7ded246e82f0346b, 0x064e0913cfd1c2e7,
+    },
+    {
+      0xe3995f778ce342ed, 0xf8862e74443ab126, 0x745ab6372da5aae0, 0x0563d7cdbbc228ad,
+      0xbb371f8bad34fb42, 0x657d12b3bf8bfb75, 0xee1e5ed1f0d45dea, 0x2763008a06772656,
+    },
+    {
+      0x35f91d9ba345ab58, 0x24a0c73048ff2aa1, 0xfe3c9c61e1e8d5a2, 0x2d548d83126fb46d,
+      0xfc23a4d16ead57a4, 0x9f377a2e3ea8e3c8, 0x3b3d059fd93d26e1, 0x0b39114aef64619b,
+    },
+    {
+      0x3eb8b1b7c2cc2989, 0x5b3a6363d6593686, 0x0142ac3f5101090c, 0x1b3a3e61b72f375b,
+      0x7123259986093508, 0x0ba6df7bb57a42ac, 0xd12b7053790ee429, 0x26d93e4aaac9eee5,
+    },
+    {
+      0x043c50b91c750db1, 0xe15440ba76f0e3f8, 0xe88a74e13fc0a970, 0x13765b6807fbae15,
+      0xfda58b6906047b8f, 0x530a40acce243fec, 0xa41ad74a28edc113, 0x28c3c89988469ca3,
+    },
+    {
+      0xc48fcf7b5345431e, 0xca02102b5cba9656, 0xdcc99b8f314c9250, 0x0b275b92145811c0,
+      0x479a7fa9d298b6da, 0xf874ff1958c8c0f2, 0x4e294507b8a6b988, 0x03f73b1863062283,
+    },
+  },
+  {
+    {
+      0xc9000eedb413b6c3, 0x69c67c323aa984a0, 0xe44a087e2632b5bf, 0x1e197de626a005b4,
+      0x2b10cc71fb8fbef7, 0x0429778f7a3524a3, 0x4f07a5491409d4fd, 0x1f742c98a6474df2,
+    },
+    {
+      0xb11719d38f01668e, 0x7a70e437ef58a1ec, 0xa9ec443171e91ea0, 0x05059b30c9c451a1,
+      0xcc33a0c46ab35224, 0x4cd69b44f2bb50c0, 0x5a4cc52ce63ac482, 0x2b5774c895962fa9,
+    },
+    {
+      0x5a22e6c71157b0ca, 0x6fe5366a6a358edc, 0xb1a538a7f37399f5, 0x0e6715023ea66fdb,
+      0xd7b45acd067ab952, 0x4d2e499f10405ca2, 0xc5d8323539aeac42, 0x0073f46120b90702,
+    },
+    {
+      0xaf5b1473cbdefe21, 0xab044c3d7946c6ef, 0xe8926578b3dc4c0b, 0x014261257c17a0ec,
+      0x5543491c9ca9016b, 0x663bca9420eef7f9, 0x124e9eb68c3d6ac5, 0x0e74785a791623b7,
+    },
+    {
+      0xa09a7f2cc0213d13, 0x128830f0d1ea3156, 0x5a588dac8e89f7af, 0x16e2717e1f370180,
+      0x3830cc2da466787f, 0xcedeb74e9d75f762, 0x13a8297fba76ccd6, 0x2f9882dd6efe3d00,
+    },
+    {
+      0x79a0f9ce36c79137, 0xa0a27d7ea41a5190, 0xe8c592470c923009, 0x0c2a6326d26c627d,
+      0xe0905cdbb4eb1ab4, 0xa2d3fab5ea668ec4, 0x43fd69d652f61a50, 0x0aecc182b41d77ee,
+    },
+    {
+      0x3d3539e4dd9f742e, 0x09d2911c5588304e, 0x1f9bf01db1a14b48, 0x23eb5b11263c6f9d,
+      0x79f359ab7decff0f, 0xf07df1bf99d00455, 0x111523a77c877f69, 0x0a100b03721e7830,
+    },
+    {
+      0x6f04cf6f26041f22, 0x25cc5275e6687ca6, 0xf3b722b638faea51, 0x2b9e5eccdc5f2bbe,
+      0xf15a8edcaca47c28, 0xf09fa122557f6533, 0x4a4f69b35f8a3afc, 0x28671acfa3830f39,
+    },
+  },
+  {
+    {
+      0x91783c7fb1fb3529, 0xe6021388ad22d727, 0x6f5cc1abae2d6ae0, 0x16c6ec3d9833386a,
+      0x2a6f1f186954f824, 0x99880012fbeca9bf, 0x11a4930fd77171cd, 0x03c1703b39a234a3,
+    },
+    {
+      0xea515bf646ecb6a1, 0x0a97359e99e0cf28, 0x2deb476863daf525, 0x25cb5e3f2a9f1bce,
+      0xbfaf4978241b1925, 0xca0aa92b9622ab3a, 0xcdf5bd51a8980ebc, 0x0b0c704a89336de8,
+    },
+    {
+      0xeb6f03f1ba368ade, 0x47ca744d85dab42a, 0x94080544b184fb71, 0x133a3b3e0ef95892,
+      0x752e69fed0dd5d4e, 0x8a5b5fabd8354d57, 0x4a328566ba5190db, 0x09f0acc6c70b6c85,
+    },
+    {
+      0xf856ff38f3d21add, 0x020dd52dda96fbc6, 0x1ec7f29bd7c80fa7, 0x138ef15123590abe,
+      0xccb90cd452ad8997, 0xd27e4be8f15a4230, 0x347288ba276fad65, 0x088669fa80061c16,
+    },
+    {
+      0xaa7c1e2484b608f8, 0x960357eca6a3105c, 0x8f42b9132206d8e5, 0x02a76dd978615b0e,
+      0x1549223507e5c8ce, 0x9309fc542f0ea183, 0x3f92fc147b84508a, 0x1bf3364f03568674,
+    },
+    {
+      0x9fffbcc8f8ab6dfe, 0xd1bb8b05e774eafa, 0x4fbb33cc7fb82435, 0x13a98314617ecc56,
+      0xe0d2dcfe40586225, 0xb75804053af33584, 0xd6ba7d10f39414e5, 0x01d9561bfdbe3e78,
+    },
+    {
+      0x4e0b06d0bcfb9e3f, 0xcc40d5e0d367e330, 0x3bbc33e70bca5380, 0x030ff45c7c71d79b,
+      0x784d8d9fc2116cd8, 0xbeb2aacec0314bb2, 0x3ec8b8653b4198da, 0x0b4978f161444b9e,
+    },
+    {
+      0xf147a93868b06cdf, 0xd9e8e21dac8d9f1e, 0xdef315ed1abee435, 0x07dcc6f5ec08151d,
+      0xbc9fe90556bad692, 0xefb730e77320538c, 0xebf170385244e1d6, 0x26ceec46b5e19fae,
+    },
+  },
+  {
+    {
+      0x267913f17bf68378, 0x24878b007e26fd23, 0x52818d7cb5664997, 0x2e1ff95f50992594,
+      0xf5734878f34faee5, 0x7c9f9938bf8c5fb3, 0xd17e930bfc086e48, 0x1e9451f2dbc128c5,
+    },
+    {
+      0xe9dbee96e3ec27a0, 0x0df320e8cfed9dfc, 0x101e7b895934b8f4, 0x13fea33a3dfb9fe8,
+      0xd212ab5f8ec2cc37, 0x06ebac5a322160f4, 0x52b4212fc3f1bcdc, 0x2a4bbabb70bdd8a1,
+    },
+    {
+      0xde90e12b025ef61f, 0x6adfcae14061f005, 0x6bca16bf6dd92e59, 0x28023d98b6bb3596,
+      0x8b03aabaec6f0341, 0xafbbf7a3e57a1b12, 0x02f7f71e6ea5c77d, 0x255d9d038b165e60,
+    },
+    {
+      0xf0c08253cefad6e3, 0x73c0b095fd972429, 0x26f969bc164fcecf, 0x1e1ac0598c27b098,
+      0xe7f6b3e9f28e776b, 0x7948c265ea4bacee, 0xb07d184b8cacdbdd, 0x1cdd034904f576ec,
+    },
+    {
+      0x6a1ae2a800637735, 0x3cd1df21a8fed803, 0x01752d5dd4edd6a6, 0x220c291142941987,
+      0x214d8cb5842b740a, 0x46431dfab9738c30, 0x93e931454d0ccdb0, 0x1b48e9557c4e287f,
+    },
+    {
+      0x65a725fa1cb50a98, 0x57e594738f52f1e7, 0x55764241eb83a6b3, 0x2bf8558e2c6ff106,
+      0x70b78d8d52ff254d, 0xcf9bd46788a18a51, 0xa0cd9ee4d1102bbe, 0x0f44811bf462bcd7,
+    },
+    {
+      0xd835b4c10db5b2d9, 0xd9c6331edf4279d4, 0xd2f48e90b03e9ebb, 0x2bc1b06de43456ca,
+      0x6f04227fad65f74b, 0xf0f1afc1bb0ad6d9, 0x4f43e031f86a14ce, 0x088986d72ff14094,
+    },
+    {
+      0xda3fc7bb5b1b42b3, 0x754670089f9a3776, 0xd9b624090100f4d5, 0x1b806dcdbb5d8447,
+      0xd69a08cc330450b9, 0x30e0f9752c1b9763, 0xa535a674a7459df1, 0x2447af72b50becb7,
+    },
+  },
+  {
+    {
+      0x154d782c4386cdbc, 0x860c775952b5b81e, 0x1506eb1d85cf890c, 0x0381f50c05cce4d8,
+      0x12fa34e388ceac30, 0xe4fd8683dbbaedfd, 0x0c2517b9bedc6c5d, 0x2ac87fa5f204280f,
+    },
+    {
+      0x92fca26b592de0e5, 0x6089d0c70c49a8ca, 0x020d03ce25bdeda9, 0x1ebf09ffc2836412,
+      0x502ca5440b17bc24, 0x967e5ce0b2d10122, 0xe4450d4d1e75299e, 0x1ab51315bf2eb9e9,
+    },
+    {
+      0x3e4a4aa8f42bb151, 0xdb996f78c7e3f920, 0xb2762c66706c10b3, 0x1e9a67e28d65db9f,
+      0x6bf3a28e7a2478dc, 0x5e92573edcc7e8ed, 0xaf94595340cb22f3, 0x2641d02da7a6b610,
+    },
+    {
+      0xeeecf8cfec741117, 0xb60a277473b8e90d, 0x0982df0e73efe600, 0x2677d8c91eb91a2d,
+      0xa4305b7b512e5c50, 0xc6009f702f0c2976, 0x31eaeab8cc327e5e, 0x09ca400067c9ab51,
+    },
+    {
+      0x037442260d6b233d, 0x0b6536f174453e20, 0xd818fd5e30d61e70, 0x27f5f8fc6b4f587f,
+      0x7eb7d9051d4b6c34, 0x5dc9e9057f95720c, 0xf136d229bc7091a8, 0x03551e8aff43c6f8,
+    },
+    {
+      0xe30478a6441baeef, 0x4fd47690ab68959f, 0xf0c10df0248a141b, 0x0163fa9421e886a9,
+      0x8a661b72e4cb7e72, 0x5e733c1c62960732, 0x2037706d0ca1e563, 0x238af5689b51653d,
+    },
+    {
+      0x44158f29b239530e, 0xb6f7f0bdddad0424, 0x18f65063cb8ea7c3, 0x1680edf2f19f7096,
+      0x1a632ac575265d3e, 0x7c795f43fc5dbac7, 0x1884f75abe225769, 0x259e763aecac4959,
+    },
+    {
+      0x02a2605fac5517b6, 0x676de67ce490f9df, 0x38c0171d39f446e2, 0x1373ab22d66065e7,
+      0xbb2f2a95b71a6e3b, 0xd8f150184fed74c3, 0x1ccc3f565b4f7619, 0x0506e8038bd306c2,
+    },
+  },
+  {
+    {
+      0x31f06ea32c920184, 0x99dbbc6148176d7c, 0xb8ed1d7d3a96dd35, 0x1f90b7bde9666bf1,
+      0x12d7076364df150c, 0xa1c651f790f78fa7, 0x5acf512a326b4c21, 0x1e3e806ba5a9306d,
+    },
+    {
+      0x4f7465df4b4874b6, 0xf0f47fb8258a3865, 0x02784df8b0ce1bc8, 0x2baa5dd2b601d69c,
+      0x1ccd920541b425fd, 0x75e0d67897ce0ac8, 0xb6bb173473af0038, 0x2c96b6c143fd1796,
+    },
+    {
+      0x0e4ad3afb2b0bd6b, 0x45fecb8838b111a0, 0xe454cb95094ac7b3, 0x13a4472fae62e787,
+      0xbe6c086178cb9968, 0x5bf4dfa09c5d2fec, 0x32439b6cf741026d, 0x2df958240f6a49c8,
+    },
+    {
+      0x064cae3ded3af207, 0x43b294d0a65df57c, 0xe5d59748ad2eeaf6, 0x225f41e0e0bc0bff,
+      0xcbb638e6cfcfcb98, 0x93218bed133b7c3d, 0x421eb8ea8f26e509, 0x086ff3bd41fa4891,
+    },
+    {
+      0x1951a85f7c602c00, 0xfeda699d805f9476, 0xf27878ab6a35319b, 0x06a0d8f021abe587,
+      0xa8d65866ad7331e0, 0xf5fccefd97bbe28b, 0x4ffd8013e8762973, 0x18d9f763ea64a8cd,
+    },
+    {
+      0x28e76769a7f3a483, 0x3f0830abc3f1420f, 0x7c95d146e5e4de4b, 0x2499db60043a3fa0,
+      0xa65993235d5ef34b, 0x5a507bf4f793eab2, 0x81b7459f3beaad20, 0x2fd2b27f0c1b9c68,
+    },
+    {
+      0x31c47cd1abe1e579, 0xec40ba58c782818a, 0x8930a5efa1bebe97, 0x0384abb577515986,
+      0x9ce803cc333ea63b, 0x8d6e3612007b3df7, 0x99a0942b5cfcb665, 0x2c345ce09d2f3abb,
+    },
+    {
+      0x8b9463aa63e6a580, 0x5fc68a4095452150, 0x972d55ecd30b9f88, 0x1e8db674818c2e82,
+      0x1451b79236023746, 0x3d5291db26bc16b8, 0x29030689de768de4, 0x11628c2fc556a43c,
+    },
+  },
+  {
+    {
+      0x49b8b85411f96460, 0xebbe3342c6f8a072, 0x9283c56ff633b768, 0x2b4aeb703ea873a4,
+      0xc5258b17476b059d, 0x85472883602c0bac, 0x16471fc077a458bd, 0x0995451f293582ad,
+    },
+    {
+      0x4caa1e503359f3bb, 0x8f331fa146d60e0c, 0x7fbc7b1eb618d3a9, 0x12eeb5b29c4d7f41,
+      0x5f1ecde8b2f7e59e, 0xc4b83bfe15aa4838, 0x8b24ab3b9e7cb939, 0x01a631cf233bc212,
+    },
+    {
+      0x1d3df85a1a88de9a, 0x62a2d0bf3d2ed8aa, 0x4a64a96460f7d390, 0x12340ac56ca5f2be,
+      0xf4f09ba2a9d91e0f, 0x08b379ab960b1b5a, 0x7b337c3f90e1fcd5, 0x2cc991e39726d5ad,
+    },
+    {
+      0xdcc27315c7789ff7, 0x25786bdeb786480b, 0x888341177aefdf75, 0x15e98c56d48e7e19,
+      0x275792c15b82b02d, 0xe373d6f54006575b, 0x4ec669ea717c21fb, 0x2f5191291619c4e7,
+    },
+    {
+      0xdb606e6208ee060d, 0xe4226a2ccbbda52a, 0x5de378f729bf2f6e, 0x1cc08ac68c3b2953,
+      0x1de60a62c6c626c4, 0xa5ed6347db9048a4, 0x73b6c62b419e326c, 0x1ae1502991724063,
+    },
+    {
+      0xab655d75e859aeef, 0x1d252024aa1d51c0, 0x3d287e32cfe94563, 0x1a45c84f73deb1f4,
+      0x7e186c210ae9293c, 0x92f5cb7f3d58e448, 0xd761cb68c170f861, 0x047788bc71fecc88,
+    },
+    {
+      0xa7497aca2734f4ad, 0xee6adcbb267db657, 0x152b0a82702b534a, 0x2b4f1b8f3e6085b7,
+      0x1f33a91faf5fb7c8, 0x0838c5b4f9c4f403, 0x26257a854bb56619, 0x0f4d23741a65b0d6,
+    },
+    {
+      0xe8381c7326461238, 0x3ed66fd5ff80e0cc, 0xf4ed5288a3122075, 0x1db45a525c0fe3fd,
+      0xaaea01b3c1f54f83, 0x3750b0992b5aabd2, 0x60abe0f92caa1067, 0x0089cf81430e5e9a,
+    },
+  },
+  {
+    {
+      0x2583def2350bb5c1, 0x043004d7a9110511, 0x83800d47d3c10e6f, 0x295772eebc044ba3,
+      0x603e9c20bde0a35d, 0xbf224593a4da1fbf, 0x63f0327cfb7c4b94, 0x1ff0f7dda6954a56,
+    },
+    {
+      0x0cf18e332429d317, 0x90273876547ad482, 0xc5fb0ec92e184994, 0x1440861ac66fb163,
+      0x0f5d3d5c973cf928, 0x6bc69948a8e07ba6, 0x30c7bc9c48d1e816, 0x292428c76a667a64,
+    },
+    {
+      0xcf13dc6373cbbfab, 0xed362aa31202de33, 0x7aa23a65e7a9685e, 0x015f6a430ca1ef5f,
+      0x1a0e9674c350885b, 0x0edba86549457f0d, 0x6913a138710fc648, 0x11196e607a1fe67d,
+    },
+    {
+      0x508c5dc130ae9356, 0xbd53442711cf2e6a, 0x415363d3077b71fc, 0x0e14f5bd8884c5f4,
+      0x4530884543a46fe9, 0x81ec1bb9d758b7bb, 0x8e088cc3c0619b61, 0x0eb1ef1f831f5f44,
+    },
+    {
+      0x4cbdf35d4f640c43, 0x0a1effdb592051bf, 0xe1a61f07ed58a5d8, 0x1b46cf137392a614,
+      0x75da2706e4dffc87, 0x7aba3fdd239d85d0, 0x5722ac9acc5123e1, 0x1c0c2f0070ac03b8,
+    },
+    {
+      0x5b2be63a77bfaa50, 0x684d3588bd813256, 0xcab555f97594923d, 0x2e1b62f9911f7755,
+      0x8938c52b309511b2, 0xe294e1638629a95e, 0xbcc31ae71e90a90b, 0x09a3a673caccb30c,
+    },
+    {
+      0x4cc77b30e9a14163, 0x63e15e9e61a057aa, 0x33a7bc4b325660b7, 0x1cdb0d1a66306432,
+      0xf877727abc112d6b, 0xc27e0d3504c1b79a, 0xc8245d970f5a782d, 0x09aeff4d7d7dfd18,
+    },
+    {
+      0xc38fcb83f51b1e17, 0x3ad484936fa8d6c3, 0x0535a9194d8c7107, 0x1425b8c8542f57fc,
+      0xccea0623618d7257, 0xe107b75cbe976bf1, 0x96f220354b975687, 0x3050e7f1ebcd7873,
+    },
+  },
+  {
+    {
+      0x835d831f395f54b9, 0x08963b748dd91e6d, 0x088b8b0279b62a1d, 0x15b1423ba43da315,
+      0x212b704e20ff447e, 0xd20fbe0180e6fff6, 0x14789aef12d7732f, 0x29ff86631002aef3,
+    },
+    {
+      0x4255b8601dd10b6d, 0x067817229e2c8a7b, 0x5ede2221c62a77e6, 0x192fa614e119aa2e,
+      0xdd4171ab6002aa59, 0x9a7bda15d0f4e647, 0x5ede63a20cfb3ad3, 0x2e4992a7c2455c75,
+    },
+    {
+      0x7b64d741bfcfb73a, 0x30018377939ae3f9, 0x1ff0f09e668d4512, 0x064affbd63cb6eb7,
+      0x47561ed4ff9954d4, 0x9f22148a71da2967, 0x0fa55c754e0cf97f, 0x296da0b3e1a38c13,
+    },
+    {
+      0x6cf5263a113089b4, 0x6bced305a566933c, 0x15c0d3db2521bd85, 0x28ce84a41dc2f5de,
+      0x78ef4798b34ecf4d, 0x16ce2a1f47b94844, 0x3a1525fd01e15336, 0x03700dd4cf71619a,
+    },
+    {
+      0x32ca2528d466df8d, 0xab19c47c16dd5eaf, 0xa453a89213543890, 0x1c61c3d03f77f91f,
+      0x58ed3c509fe628b1, 0x8b3aebcddfdab1d9, 0x79a3b216e985f24d, 0x0550ad56a3742dc9,
+    },
+    {
+      0x50944520bf764a42, 0x6ea125412bb3789f, 0xe92b59d6767c02c9, 0x224fdc55b439834a,
+      0x97dc536583e660b0, 0x32e5accc8fc4ceda, 0x5c45618a35ecb6c9, 0x1c35b1f199e6d30d,
+    },
+    {
+      0x9836dc5e9f9b6b58, 0x6a66cafc3172b836, 0xc1f7400fc38f5dfc, 0x2c2a29c4459076b1,
+      0x357b98d05a646b58, 0xb2cb66344474ae06, 0xaa9200def1f35751, 0x035c8adbcadad670,
+    },
+    {
+      0x442f5292cab08882, 0xb57c3c727fdd7cc1, 0x77dbee1aa17798e6, 0x054974d3c3159f40,
+      0x780faf9cef862404, 0xde864ceda969ca38, 0x5fc36c7f2915aed6, 0x23613a8d34709622,
+    },
+  },
+  {
+    {
+      0xe868b13035f92758, 0x1de965f84f5e6df7, 0x37b61d1067592ea4, 0x136f8725cb6f231f,
+      0xc9d22c2d7c9d06ac, 0xdaf67e7706fdbef0, 0x687141d0119a027c, 0x2ed936334707635c,
+    },
+    {
+      0x204406586930e548, 0xbeaca8dc77ff5d50, 0xb2f8db50a797b0c9, 0x0e52c3dbc4e27a4b,
+      0xe90591fa7ebe148a, 0x5dfe9022e02a3a09, 0xc232d54600d74d58, 0x08194020d3ca0544,
+    },
+    {
+      0xb14f75a44750447a, 0x3148bce51ff90516, 0xd05369d1d9d2d069, 0x2526bd31f7233987,
+      0x339595ce6a086c10, 0xc7d01b3e4fa3feaa, 0xd63a8a7680465260, 0x02985a0b5008a466,
+    },
+    {
+      0x6bcd1c3ce16b113b, 0x3befb778c0dbb911, 0x7c27c2aaff0c4322, 0x23915a113374374f,
+      0x24f3643cdfd0f661, 0x5a471f90d504b567, 0xc9465e9a20371fa4, 0x0b072f294ffb5ecb,
+    },
+    {
+      0xc2449c7f7751759a, 0xfcff4faf1f7f4c27, 0x0cbd03aab36b6a11, 0x09e913efb885ffab,
+      0x0216ba2c67491019, 0x6437525fd818b992, 0x4343c9febbb2e204, 0x24b0d84eb6eb55b3,
+    },
+    {
+      0x17580e4f43a6c3da, 0x72fd1f619a6c93f8, 0x821f306395291342, 0x0183cd96e960679d,
+      0xa6e54003595fee71, 0xd4a7e7c8798ba932, 0xe56c4fc9769eb8d6, 0x27e1f24b9415f848,
+    },
+    {
+      0x42e502d0c90f15c9, 0xdadc70aeac8dd2ef, 0xce690553ba64b961, 0x2ecd241676c96e95,
+      0xf316e9c1d111ee08, 0x3eff1304f65e13c4, 0xa43ef13b13995478, 0x1268f2426f31a4eb,
+    },
+    {
+      0xab46ac408a15bb26, 0x4c83f099ba3bc462, 0xb9117f1b1ec20c08, 0x0c0d48350aace112,
+      0x4f7e0c466cbbbcbb, 0x0327b8233cc5ad6b, 0x215f01c96589624d, 0x0f0f2802e05f9007,
+    },
+  },
+  {
+    {
+      0xb677328791a748ce, 0x90c3171d7ea7cce4, 0x5712eea756b3b17a, 0x28afec986e2b7c2b,
+      0xe049330ebd91590e, 0x8dfccdd16f55b4ac, 0xe20e631686ce7c5a, 0x1a49ff138007925b,
+    },
+    {
+      0x08520f6c033c7f0b, 0xe7914f6da8627c6e, 0x95c32683aeb4d351, 0x2b4c78ec299b7e34,
+      0xd7b1b58ada3a2cb3, 0x87775a8ed02c4822, 0x05203e5f519e3a7e, 0x171c144b5adde216,
+    },
+    {
+      0xa6b55cc1c070771f, 0x9861c4e6174a94f4, 0xe64638b6a7c7a9bf, 0x18a92b8cccd129d5,
+      0xcfdfabdb564883df, 0x4ebd4462493683d5, 0x9215f373ec61b364, 0x13eb3710bd615977,
+    },
+    {
+      0x214fcfd0ef2e7753, 0x32a5e2844f4468b2, 0xde64bf0c627fa721, 0x2178cb924dfec9a6,
+      0x963805b79f051412, 0x46a89d93cde7f968, 0x32bbfb256ed36f4a, 0x20eb414be772b3a4,
+    },
+    {
+      0xa16f7e0f87f3b4ac, 0xa12c900b3d8ae908, 0xd8320b211eec3971, 0x20edf60ebc4cb3dc,
+      0xe6e2c9c2fea2577f, 0xbded059452a2bd21, 0x54d3f66a9d02eb6f, 0x02d197e086d774e2,
+    },
+    {
+      0x608a963b0a9d44e1, 0x1d95aa337ce63491, 0x4a4ab59f4d6f726d, 0x0670ede8700cc8d6,
+      0xd54c68357f821946, 0x2f3ede5754996a03, 0x23386ce7389e0c25, 0x123488c3109e2179,
+    },
+    {
+      0x0d8bec2f79768943, 0x511a8a8a61c9fb46, 0x14b071fcd5898bba, 0x112dc78017a9d0cd,
+      0xdb161f2237279d14, 0x1455673ad4ba1970, 0x7e9b455b91f654ca, 0x0e84fed77b99e343,
+    },
+    {
+      0xb5da6dcc5300b490, 0x172e399edede179c, 0x2138a5209eaf30f5, 0x249920d9d38c4c11,
+      0x8a03c56872bcc66b, 0x5c9ecc51dc8ec59b, 0xc198deeccb0b64f9, 0x014f63251799a6bd,
+    },
+  },
+  {
+    {
+      0x55acd32d1505f7fb, 0x5451f7ef374da6c5, 0x82b8702b65bef4d1, 0x14557ef89acd58b6,
+      0xb3bdd8838b1b4797, 0x0e2c84bf2eb0043e, 0x43e064ce22faaa13, 0x29e09ee553cc4935,
+    },
+    {
+      0xb591a78fceae65c8, 0xd568e2a1edf63e0d, 0x5858ccaeb5a39601, 0x25638ac813d6865a,
+      0xc2bec0319bef0057, 0xfa6dddece01816b5, 0xe31d1d2ce6d118e3, 0x1ba743ad7c1b3445,
+    },
+    {
+      0x898463b133ce6008, 0x8c99ccbc13601fe8, 0xe70fb57c9cae1f8d, 0x1f0b4c9c47dc5829,
+      0x34a227b20cc19bd5, 0xca58d9176d07fe3a, 0x6f7d195a29e17ad6, 0x2147b139d1e26026,
+    },
+    {
+      0xb496fd92d0f74b83, 0xc0d26a3fcd4f64b0, 0xfdb070accc30a449, 0x0b9c09f30dbcd756,
+      0xf812a93f5e20decf, 0x10309e71db288297, 0x9758e1799d897448, 0x302f84365a588d8e,
+    },
+    {
+      0xfde3bc39383e7e31, 0xea36c1e7bbeb92d5, 0x8cab4308b615f162, 0x047f94be4cf0aa4b,
+      0xc6be4ee41a2836b0, 0xecbc871fd4f152ad, 0xec5606e5dd4ec0d7, 0x0e3ca153c30e2d04,
+    },
+    {
+      0x806ed76dd82d0d76, 0xa8d4733708bee440, 0x928d6d29f97ed790, 0x0bb2aec59fc08ea0,
+      0x530fa0c0273f7781, 0x239df5296d854636, 0x648358cd7da27f96, 0x1334fc76dd10cbd7,
+    },
+    {
+      0xa89ec4c655c85060, 0x987493cf9fda5dcd, 0xd813073adf79a99d, 0x2ea1affd267c2fed,
+      0xd10ce7ee43e7cda4, 0xfdaa707057d1ea24, 0xb319a93dcdcbafe8, 0x283fb43ec1fa3a61,
+    },
+    {
+      0x233a08f940ff2e29, 0x3819d68d4278e4e5, 0x95e18eb86155abfb, 0x29f7e133154f23c3,
+      0xa185949b1e91f4ed, 0x69509f6a066514e5, 0x6d9c84420e8f042c, 0x0efdeb8d1d0ace0c,
+    },
+  },
+  {
+    {
+      0x4beaccebda9211ab, 0xa3965903334f9d76, 0xde4fa5e28d5e4357, 0x01dbd462adc87a58,
+      0x168bf038bb789cb4, 0xa2e32be88fc67eec, 0xdf8c03d947f8678a, 0x00aebb3fe47c14ed,
+    },
+    {
+      0x593d3e7032dbb679, 0xc5c8b6f99b14339f, 0x0c90556cd7583921, 0x043033d696a3daab,
+      0x7cd7b3e1bf78e11c, 0x0a1b689cbeecd0f8, 0x436a2ec7c81e9745, 0x224791c8b06cb0c9,
+    },
+    {
+      0x1157bc4fea77656f, 0xbf554fbab2406cd7, 0xb783b388540dc07b, 0x14755c45ec59de18,
+      0x80c4e41c57b2da76, 0xa077544b416d7933, 0x197a1102ca89f27e, 0x2d2465a58ce8b295,
+    },
+    {
+      0x5654312b08e10270, 0xd698da593a636dc4, 0x162d33dab37f7ff5, 0x0e97aa7248896038,
+      0xac35683f18bd8a12, 0xd8ab980a1134ae20, 0x9477da35c6244e5d, 0x1ebd03492968aa46,
+    },
+    {
+      0xed6cd10664c28a59, 0x0912adf990efef7b, 0x46540e2318b9da9a, 0x208e1c2d4bd85abe,
+      0xdb31e3ad9cc12fff, 0x76672eeaedb3dc24, 0x6b4b8fe163e31b71, 0x21f8a911851c643c,
+    },
+    {
+      0x8c23c59577f1e0cb, 0x93f293f01e8504b6, 0x70bdec1cae0685c2, 0x2d403a3d5a1f96d1,
+      0xdff79b162de3256b, 0x4a197304e2850674, 0x77a6f2622e3fddeb, 0x0ae4ceeca2cb8817,
+    },
+    {
+      0x87a5f7973df03f91, 0xd084f788086ee5cc, 0x6cbbd7ee6515dbf9, 0x1683c061336b3d66,
+      0x50518c608657a87d, 0x480fb101a84079bd, 0x38b0549d9deac986, 0x137cc5ba5285abd7,
+    },
+    {
+      0x418f0553ed149e72, 0x4e7edba6915ce783, 0x33432df73aa9175a, 0x02e5a83722209b03,
+      0x10f16cce8ee01abe, 0xf0a3845b151f1732, 0x448462aac06c4688, 0x15d9e8dae271ff0c,
+    },
+  },
+  {
+    {
+      0xa921bfecd6c42c4b, 0xf5e0bd5e60cde2e1, 0x58ad9ee7a175ba34, 0x0139ba7dc4720f4a,
+      0x0ed1e2522032d01f, 0xa9b926a7e874b508, 0x162a76d458d236a5, 0x2366701a65df112f,
+    },
+    {
+      0xd6a62421151f5932, 0x1dc6e6b5d9c22cae, 0x94a47ae3d6269699, 0x0daed202f1c31860,
+      0xcfd908aebc5cfe52, 0x91fe67b2529f2287, 0xf4404abfe655d57c, 0x2741b206aa9f6efa,
+    },
+    {
+      0x4134b994fc35a59c, 0xad87fd2d69b80e3c, 0x2b5ae11658e7097d, 0x080a815837c4fbfd,
+      0x9b61ef4ef7c63e22, 0x566c88e9184d9dca, 0x63530ba9b92d0ad8, 0x267e822be90385af,
+    },
+    {
+      0x97fe83f6cb81f6db, 0xde591f341930d82f, 0xfb4c0eaa221fbd19, 0x21edf8e42a75604d,
+      0xc97636ce2092458b, 0xded011dce1e8a6a6, 0x778d10349c5be0cd, 0x0cfaf866d681727d,
+    },
+    {
+      0x102cc9e10ecf4303, 0x2488a1c1bab41dd3, 0x51c64c6fbcf4d983, 0x06d2fbed743b48ed,
+      0xb135fa927f3c451a, 0x25f8e4cdbced303b, 0x18ccb21588fb9e70, 0x100fecc365497a14,
+    },
+    {
+      0xb2d275dc98a31565, 0x46a74fac78b21701, 0xb30fc2035805bd97, 0x0a5a1a40c2babc1a,
+      0xdd000817d7d90378, 0x22ef4a2d77ec4ac4, 0xf10978f8954b37f7, 0x1e5ee739063d5852,
+    },
+    {
+      0xdd5022d1ef0b777c, 0x2526b0e45d3f4687, 0xdd682cd735755b88, 0x1c8f9330642cd8c9,
+      0x03ec7a4bd0bb4c09, 0x30550ad5f16a6486, 0xc63e2d5f677cb7a7, 0x18f3e471df9ef235,
+    },
+    {
+      0x413fa1579d2520c3, 0x57f92ac2df441314, 0x9557879136809a92, 0x02e68731e97490d3,
+      0xf1a124d807001d73, 0x01135bbc3606f318, 0x70a354ef071d5893, 0x1464564baa36fd7e,
+    },
+  },
+  {
+    {
+      0x1eba5c3dc9a516c4, 0xcd9d0e0c67d93d81, 0x2a3ecfa3cf751b3f, 0x1b20be62d8151a08,
+      0x776f3962fad2a75a, 0x890939e0cfc6413d, 0x6df85ee4b82eb32b, 0x2493f2e029a96d76,
+    },
+    {
+      0xe6e3e8c56716f2a1, 0xdf36a8b3f5ea2dd0, 0x2485838a6fbef65d, 0x209cc914a04f6de9,
+      0x326d9f05ada1a8e1, 0x0a004704bc8179ff, 0xb28406106dd460bb, 0x02f291fc83366ef7,
+    },
+    {
+      0x49d3f02d2d17d493, 0xa6a4fc10ecb2aae8, 0xae3b6d975ab8152e, 0x0374db063e1455a4,
+      0xe5fa0db3e632b666, 0x6a9c07035b4e5b25, 0x18252cea85145d5e, 0x22337163a2fe05cb,
+    },
+    {
+      0x0b5d84cfab7448e9, 0x8a650be6c58496c8, 0xe9277e0b9a47b80e, 0x1b7fe32527895a51,
+      0xd8d40a3578bf77ff, 0x68af63fe71cd0669, 0x5fc31a1dc69569a6, 0x2d88e31255ba5df9,
+    },
+    {
+      0x93e78fd04b6ea963, 0x73dde128a209dd14, 0xda536d668ab69bf2, 0x161754d71e35a3bf,
+      0x162baf8a7f494c4b, 0x1f0bff0c8e7d08f1, 0xaee5ca8d5b79b032, 0x2c5ddfb2f1d8b1bf,
+    },
+    {
+      0x8fa15d7e223bfe2c, 0x03115718a7437f23, 0x71e95f3a9edb8346, 0x2eea490f2de212b7,
+      0x7e65fdc941f58961, 0x7ee33cdb60249236, 0xef5353ec600115d4, 0x059de7ee4fbceb5a,
+    },
+    {
+      0x20c8a5f3cbf237f7, 0xb10d89fdfc5f30e0, 0x79251ab3b10c1035, 0x1036ab240576c0b8,
+      0xf8b430215d806f05, 0xe11e357e4880cb0b, 0x0e7efcd0edb40201, 0x25b65e8b2db0296d,
+    },
+    {
+      0x277431f866e35887, 0x9a23f844c7d017c1, 0x25ee8c0da617a6a5, 0x2eddff543389b9dd,
+      0xf3d7cd74b29aa264, 0x9ece5500c2c49671, 0x78f4ccae1e5b1998, 0x02ffdb70eacbff46,
+    },
+  },
+  {
+    {
+      0x031c84b76cc1411f, 0x545558cfb8a4596e, 0x3735f1abca37c92a, 0x08720a8821afeeb5,
+      0xa109180e874e7dfc, 0xdbb1db226f700905, 0xdcf6875eb18c9183, 0x0c78ce86763b4f4c,
+    },
+    {
+      0x8b57ae933723b681, 0xbb5225da6c087a0d, 0x08327e948593df2e, 0x105281a8587cccb2,
+      0xf6c6155917a41bd4, 0xa7c047071da49e91, 0x5a4e8f2b3325003b, 0x171da9105657640f,
+    },
+    {
+      0xfca5b9797e4e873a, 0x54698318463b5fcf, 0x3ed6734ea3d6c3cd, 0x015a7fc5d8c41949,
+      0xff93ee179a93f41c, 0xd2b7976bed9881de, 0x60006481890b6fb3, 0x1debf171f8e6d6f2,
+    },
+    {
+      0x7a4bcb327d798a1e, 0xf2f326328ed64d09, 0x1f4dd120917745eb, 0x25f3ad6949ad1b51,
+      0x26ce9bd9fc236a35, 0xf7f2ce717f79e5b7, 0xe88e3814799d0090, 0x287162e513d028a5,
+    },
+    {
+      0xfbb0a302f7d5d3b5, 0xeb842308d9dc49cd, 0x5d7fbfd5f8592362, 0x2a379b59eb5c84d0,
+      0x201290df1e46de8e, 0x81586aeb70af1a31, 0xd9be18e39ccfb6b0, 0x225de68d6fd72716,
+    },
+    {
+      0x60bdd74930bcbd5d, 0x94ad13e4d8361e1c, 0x8a62efdebafc3e7d, 0x09c8e73c228f0753,
+      0x215a87768c67cba8, 0xc95623f9ff297733, 0xa5a6cef6f987b6a8, 0x2a7d07d11162866a,
+    },
+    {
+      0x7e3a345f038088a3, 0x7be6d959ba05c15a, 0x4ce70b252fa642a8, 0x02ef442d8a4c097d,
+      0x908ab94065810606, 0x8ecf2d4d09217b6c, 0xaf9f3e1c306ade8f, 0x08b300b69618ca3a,
+    },
+    {
+      0x3e2cfffff4ef6398, 0x03a6ee7aed699896, 0x6a1a890204605f91, 0x0e6571b166398d24,
+      0x65a28a95d8c4f1f9, 0x44b96e4205dab850, 0xc1da962f6c8b7d8a, 0x0c6432bae496ca5b,
+    },
+  },
+  {
+    {
+      0x60eeed2441658e82, 0xf3af0e097ffc39e1, 0xbaf5a3a941d16831, 0x13e87af1ee313fc0,
+      0xa0ba1029aee70fd0, 0x87e6ac7e6a92b871, 0x6e25c415a1b37f2c, 0x0f2cffde11fdc05e,
+    },
+    {
+      0x723ddb6cf6a2a545, 0xbda791869cd7c4e7, 0xa669145f49a5ce04, 0x15bd78835b301773,
+      0x7aecb1c25ff42ac1, 0x8d5715d77ba7aaea, 0xa9b8989e8c40c48e, 0x10a8a3ce806e7a72,
+    },
+    {
+      0x771ecd640986d602, 0xa3ac422428ee79b3, 0x611bc7ef1b9155eb, 0x1650d3c8677c259e,
+      0x1f1bf98d930da4db, 0xd2a717ab161dd97c, 0x937864e937e346b6, 0x26a81b06f095d886,
+    },
+    {
+      0xaef3de19fd1a9b6b, 0xe85adaa68fa08e9b, 0xe966e5f74cb2dfa9, 0x25c1f55326644dd9,
+      0x0633c346fc92a113, 0x7c9d2e429ce36ea2, 0xecd8a5ae5aa18557, 0x1ff9fd2a29860983,
+    },
+    {
+      0x3d555166a095f51c, 0x5ac9cb39d416465a, 0x1bd2c745190a1636, 0x2e0c680b3f0b1283,
+      0x25dedc7f6d082a7f, 0xacd51c2e8aa0f701, 0x5f835eccf5785993, 0x0376a63291f71c6e,
+    },
+    {
+      0x9fdb7a7bbd7b9d2b, 0xe8fd046f012efef7, 0x748e8a29d568b3d7, 0x18277e0e21218cc8,
+      0xe6d85db502e1b116, 0xfc264b8764d3038d, 0xb7f20821ca53ee39, 0x0f6e3eb4143c3f6b,
+    },
+    {
+      0xb3ff21690bb54702, 0x4dea72b12f1197df, 0x5c0c07e9e2a54e0d, 0x049dbfec1e6da21c,
+      0x99d9cf50b184ceaf, 0x517c1fab39f2942a, 0xb6e667800d69a6e6, 0x2341ea8d919721c5,
+    },
+    {
+      0xc637b32c01d49d40, 0x23c05b28ee1bb37b, 0x531a6c503efd3b53, 0x2fb375af533e2c36,
+      0x7a4dfb8a13e596d8, 0xbcbf94d97f1559bd, 0x63f9b5db456fd05e, 0x125e1e2df07af5ee,
+    },
+  },
+  {
+    {
+      0xe20f74f29e243904, 0x67f3c783baf04ff2, 0x8f92597a6e0f6a12, 0x0459bc494c65e6c3,
+      0x86797998ff879703, 0x1b577097026b149a, 0xdf54b5495bad93de, 0x09c42d05e2f3b78a,
+    },
+    {
+      0x96ffcb8abd5a4423, 0x5f7e03a6895f3afb, 0x98753e75c07caecc, 0x201cc2ad73fa04ca,
+      0x261c9fce2862c036, 0x967b16e4554033dd, 0x80a95ab2c5f7370a, 0x2f4d99daed23eee7,
+    },
+    {
+      0x2e692081c90a1c6f, 0x4f842fa745c2b6fd, 0x1d15c3f98a2415fe, 0x2b5d5038cd3e94ff,
+      0x99ed02395d51f2ac, 0xcfa4fa0ee875233f, 0x9eaefc59bb313030, 0x0c49bc8d8e3f5ddb,
+    },
+    {
+      0x6f74a190aab5a09e, 0x4e6b229fa9cac98e, 0x9ab96cf627cafefc, 0x26465abcfb5bdc6e,
+      0xf016f8f7fd339c8a, 0xa99d4edd2143fe31, 0x1d204cab79688238, 0x076c8b703a9af397,
+    },
+    {
+      0x670e922e8e17df84, 0xda45b574f4cab572, 0xdcd6f997f09c5251, 0x0920bb68f3e34fe1,
+      0xd46f4a79dd53084d, 0xb64992c084acbba9, 0x34e9b48cb03af15c, 0x2395cd2f57c7c296,
+    },
+    {
+      0x74348fdfb2723c00, 0xa667fd8575dd173c, 0xbbb87dc79049864a, 0x07703c5e0ff19181,
+      0x228234fdb923d87a, 0x168b1e261895c22f, 0x693ddde856c914a7, 0x09bbce880de68c2f,
+    },
+    {
+      0x554dd877250b3893, 0x86801640d21d70d4, 0x881a997fb65e9bbd, 0x26fa686b811dca7d,
+      0xfd503184f1b49d16, 0xaeeda44729714554, 0xa65a6781d1ef4d29, 0x0ba4b1068fd9c5db,
+    },
+    {
+      0x84bb666312917e01, 0x0bf2cced3a131185, 0x7bfba33499d06964, 0x2d541a2befab69d0,
+      0xac64b7869ec0fe9b, 0xcc6c031aa4d57fb3, 0x20239f68db1a1d72, 0x12b3fe8581dc7a98,
+    },
+  },
+  {
+    {
+      0x7cb65db5a4ec74a7, 0x81e878c71748b8c3, 0x58e576071b281962, 0x19fd2cf9572ed9ac,
+      0xb552ffd87b94b0d7, 0x86d683c0d1045df1, 0x63e4573e19211cf3, 0x041b786a81b867aa,
+    },
+    {
+      0x7bb90c80ee6c08c8, 0xcfa7c2e3dce899a2, 0xf9ee4265e2de034d, 0x00eaa1bada30b64d,
+      0x2e01cc681110141a, 0x98c9f081c4084ae2, 0xe81f1e4b8ad54c80, 0x058f8cdbdbfbc3db,
+    },
+    {
+      0xafd1f5d51a494b73, 0x0b694b591614101a, 0xcb55b7486d63da39, 0x236d74a2ee675170,
+      0x0ca01300d7e0a0e8, 0xa025add887081b15, 0x0417cb585e2ddad1, 0x20be2faadf6ed8b8,
+    },
+    {
+      0x5fc3321826982632, 0x77525d3033eac2ce, 0xfd0f3856f21f97a5, 0x250658ed1616cccc,
+      0x21cf8a6d145ca48a, 0xaed6ad248a81d0b5, 0x842a430b4d57b0ab, 0x03724cbc86776635,
+    },
+    {
+      0x9d5f41eab90eb16f, 0x07972cbc139a041f, 0x62a6eabfee1967dd, 0x1773d2cb21d30335,
+      0x0df6150003d97b02, 0x74e42e7af4f8cbbd, 0xf3966d1a3f6188a2, 0x0914d192653c4d2d,
+    },
+    {
+      0xe5b26d366289cdc3, 0x703992cf0afcbc84, 0xe0e0923ec113ed20, 0x0232929a299c475f,
+      0x17bead16cc04d5ed, 0x57875adca98c4bc2, 0xcf28af98329c3430, 0x224d808c139ac163,
+    },
+    {
+      0x8818a636ccfc258a, 0x5f88f2c416df97d7, 0xff44a789a10438f3, 0x2357aa77213bc783,
+      0xe019a701f9f5e71e, 0x4cb73c99c43edb75, 0x8c3d621baa3dfd4c, 0x047aefcb1c62742a,
+    },
+    {
+      0xccf3fe4877cc314b, 0xe1d504c6a9f30ec1, 0x915eca5579b0e713, 0x100c774576951138,
+      0x44df6cebc743b9a2, 0x6263d845ae03e727, 0xa6cca57a4ff5d773, 0x0005356bae6d1467,
+    },
+  },
+  {
+    {
+      0xd676187113227508, 0xca8c602c080d93ca, 0x04993596e34a1c19, 0x216c32e381a23308,
+      0xfc69bda0daacb260, 0xb17834cc037ce900, 0x13364703d9033811, 0x00519c1ea74da4e2,
+    },
+    {
+      0xd5f89b4d435e8bf2, 0x86cf59f29ba0533b, 0x2ecc9bf0b95eb0d3, 0x2f0262c715c71472,
+      0x6d42000148fa56d5, 0x96e8ec7049e52742, 0x700922e1aa66dd4f, 0x12f9de7a67da2b46,
+    },
+    {
+      0x00bf21981a0215d1, 0xb7ce0c85506b1d5a, 0x9cee45221569e34c, 0x20833fed231ca9e3,
+      0xd933e25b053d17ec, 0x665363b87b9f0bf6, 0x9a2a2bd606748ca5, 0x024bdfda9e35b3d1,
+    },
+    {
+      0xd653551b8a4861f5, 0x51bce601ca6754ec, 0xd2057430239f12fd, 0x27be18d6279ee21b,
+      0xa10ce94817228870, 0xa6be336b1f4e3a0e, 0x5b6ae5ac881d1bbb, 0x1b94aa741c3379f7,
+    },
+    {
+      0x4ac475be10e5f8b4, 0x021bd974df1e10fe, 0xcba83cfc42eebb02, 0x151efd1d39c41c81,
+      0xcebc242ec860ca94, 0xfe81e785786b1a17, 0xfb673bd3c5f5a5c9, 0x2329d1e1717f3fed,
+    },
+    {
+      0xd02d52272d32f4fb, 0xdc7e964434688c61, 0x1957f2ced1d99af6, 0x04e36bcfdf1145a2,
+      0xcd499edfc164a576, 0x9157720af8642031, 0x5be84f73b8743a59, 0x19f38733fe0d6ef5,
+    },
+    {
+      0x00596b0e13c485b3, 0x749892374922ce3f, 0x3d63155e53447392, 0x14b8ed26f538bf2c,
+      0xc07a35307209d2d8, 0xbabbcc50a84c771f, 0x8eab36bfc5a71e90, 0x127c3534b8fcfc31,
+    },
+    {
+      0xd62774b23bfef51b, 0x491cfebcd10ba6fc, 0xbc186fe5404ff717, 0x0d030dff21e1f228,
+      0x87a71ad114fff684, 0x4c29104b715ff9ec, 0x9096ec67fca269c5, 0x1546c30f6c68aa08,
+    },
+  },
+  {
+    {
+      0x9309834d6b262fde, 0x271fc551293deec8, 0x5a076628d9484cb4, 0x24c950d701e30621,
+      0xb317b55cc900c6d2, 0x6a406fd30fa9a911, 0x2b12900b06d3d334, 0x277cad3f475d78b8,
+    },
+    {
+      0x525a6f92a7f761d0, 0xa972aac52d30f84c, 0x9b8543125ae5e3a6, 0x01779194613f3d61,
+      0x02ef1c1bcfcedb21, 0x4c7af3e8b79d9250, 0x3ff3187608ef8e82, 0x28e170d00db01f1e,
+    },
+    {
+      0xddf4983103547cc2, 0x4e546f9c8d832a3c, 0x0c67d3fab3f0fcc5, 0x065a2268f24b4bef,
+      0x9d1520c3c1b7b233, 0xb7333c2f7536142b, 0x33cac0618b80ca34, 0x21f9a4e80e6305d3,
+    },
+    {
+      0xd684a14badabf5c3, 0xb2f6a572ad567c7b, 0x5b9f56749d23b3af, 0x09557c02e4f7c2c6,
+      0x85febc415ad74acb, 0xb609af9d561cd895, 0xaed6c1c8b1eeb005, 0x2175e55006dd48b4,
+    },
+    {
+      0x5561fc0c60c00626, 0x5d3b37ffa2e23081, 0xb61f68552be4da8f, 0x0acf898607999215,
+      0x8bdba7eb6b173b8c, 0xb5ffcd8056794090, 0x4d5d023512f232f8, 0x236cff19210164c9,
+    },
+    {
+      0x62c5c236d73dabbb, 0x9b0f52fada7eb8da, 0x5bf96d66316538b2, 0x1df16fb8ad91866a,
+      0x4569b24a97ce67ca, 0xdb13d364e4513430, 0x3351621bed9e9f19, 0x250db550e8001e00,
+    },
+    {
+      0x06522136444ff062, 0xe61007de54dfb1c2, 0x402ea9bd2ab63536, 0x188949b58a0f40c3,
+      0x93fc415303aeae3a, 0xb48fddb7b0558766, 0xe379a982253da08f, 0x24e13d4692f5e3eb,
+    },
+    {
+      0x720c439089be38b7, 0x140562a6e8cf1d4b, 0xb1f147df99689000, 0x2b9e99dc6061ed43,
+      0x27e3313a3da1382d, 0xd4e2e2ddcad73322, 0x0a554d205f24cc08, 0x0b5526e4abddcedb,
+    },
+  },
+  {
+    {
+      0x5a2003b4254996a1, 0x04523f663d65b7a6, 0x9ea358dc740e1f7a, 0x1a99e713897a510a,
+      0xc6cff2036428566f, 0x913edfdcca71464f, 0x2e962aa9bc9c36c3, 0x0b6c78bef0db0d6e,
+    },
+    {
+      0x0f66d1ab913952c1, 0x393163d74dbb76a8, 0x64925fea1f788fa4, 0x016567c41a907915,
+      0x99d7b1c7731b9c44, 0x78c65ed6db1906d7, 0x4d82b0c9ae48fca6, 0x01498fe11b4d367b,
+    },
+    {
+      0x81394b8d38c36ac1, 0x0aaa9f73b26734fc, 0xddbd03adda578b7b, 0x2da30aadb58c7e17,
+      0xfb2a749a1d73de3f, 0x84e809f91e47ed87, 0x97b08577f8dfe310, 0x2b8ce423ca60301e,
+    },
+    {
+      0x9d3254a29d7870d1, 0x817ffc4e7be28f3a, 0x77bbeea7b5dc59f9, 0x0c6760e3754769d7,
+      0xa5aac1cac6c70349, 0xfc111950beae82a2, 0x296c7ffbe314a5ea, 0x066f6fae639aca5b,
+    },
+    {
+      0xee96bfd48a2e2731, 0xfc8aa7014923a778, 0xf5ba305a95efd6be, 0x26ee8439a9e2afd8,
+      0xf5d1e037558eedd6, 0xe5c9ee2e43440ff3, 0xe53510dd97321f89, 0x14a8cceeeb3ad1de,
+    },
+    {
+      0xa348e3b43a8de4f3, 0xda127db3d0a4549e, 0xd4e99d92e2975bf2, 0x29a7a9fbd8aad7e5,
+      0x1aa6b8d33e4a23d6, 0x8078f3dc306a31c6, 0x5f489b3033c35ede, 0x279f62b6ae4b989f,
+    },
+    {
+      0x2fc2cfef6375d000, 0x213eaa3c8fb743ed, 0xc185b7f1d497b4b2, 0x075d45c87c51a2d9,
+      0xa81731b11fbd4ee0, 0xb4c1e52664ca3ef4, 0x24080885fbd40555, 0x2b369debb6ea2f60,
+    },
+    {
+      0x511b21cfe977f331, 0x58d35a56b34bb77a, 0x9e3e6d7495d7ece2, 0x1b8ac1e7770ee553,
+      0x8e8e321edafdafdc, 0x05f180c502dfb833, 0x5c84b3a007b5f7cd, 0x082a533ee34ff834,
+    },
+  },
+  {
+    {
+      0xc4606bd8047b2417, 0x01b0c78b22d936fb, 0x8a4ddabe9cc47f4d, 0x023fa11d7524db84,
+      0x16227edf8dffd41b, 0xca349067f587208a, 0x75fc2b0d1e4b0dfa, 0x067fc833e541f1ae,
+    },
+    {
+      0x978f97d73c54c749, 0x4145e1f15726cef9, 0x1eae67d5cfb0d384, 0x1a427997c6b27834,
+      0x6a88a6c9a70a1c0d, 0xacba771cf5a8b3b7, 0x766c4a20a2b494db, 0x216ada96c93ff26d,
+    },
+    {
+      0x9427b40014abc2cf, 0xa8d4b17775545ef0, 0x749e167e629b77b7, 0x057a510d6e6a3d3d,
+      0xa966a61254514f0d, 0x3e2e53a407b9e601, 0x92bfa9ec78641b2a, 0x2fc4cb00084aa09c,
+    },
+    {
+      0x52263b75929b826c, 0xa5cd12be0fa81cad, 0xa326d5fb0375c4b9, 0x294f02f815e66e13,
+      0xcd7701f67c7b1e83, 0xc2bea428265728e6, 0x2ecee702238a8547, 0x1ed949f1eb0bc9a0,
+    },
+    {
+      0x9f4cabe72a930574, 0xe302d37e73c0d93a, 0x60db581175e3ab82, 0x02891c947e054ae2,
+      0x56918030f3cb5c43, 0xfdbda4115abff347, 0xc1fdddb8550e2f32, 0x0b1ceb12abc1d13d,
+    },
+    {
+      0x68712730e13d1217, 0xa309fe2be4a86933, 0x0506e44eaaf50fcc, 0x07f47aa246c0fb31,
+      0x22c35fe0ad0f513f, 0x87a45b5ca8b3e3b4, 0x2dadff1077ddff33, 0x0dc060d2811f83be,
+    },
+    {
+      0x600c6fab7f20c40c, 0x7e1bba6b2877905d, 0x00f383cb7bc5a294, 0x100f1f2978499da8,
+      0xf3c0da07500ef723, 0xd1978d828e13af17, 0xe09fa15f412fc026, 0x1591cb1470174285,
+    },
+    {
+      0xf17be59206185a44, 0x9fe3d1e9599affb3, 0xf11440006564b625, 0x2d71b6a7155b8bf0,
+      0xee84169729e3463d, 0xf1dbeaf136584979, 0x2b72f8a139cdd0db, 0x244e7e41ce581f0f,
+    },
+  },
+};
+
+constexpr uint64_t G2_ONE_TABLE_LIMBS[64][8][16] = {
+  {
+    {
+      0x8e83b5d102bc2026, 0xdceb1935497b0172, 0xfbb8264797811adf, 0x19573841af96503b,
+      0xafb4737da84c6140, 0x6043dd5a5802d8c4, 0x09e950fc52a02f86, 0x14fef0833aea7b6b,
+      0x619dfa9d886be9f6, 0xfe7fd297f59e9b78, 0xff9e1a62231b7dfe, 0x28fd7eebae9e4206,
+      0x64095b56c71856ee, 0xdc57f922327d3cbb, 0x55f935be33351076, 0x0da4a0e693fd6482,
+    },
+    {
+      0x42d3ae372af7a579, 0xd2f609cbc0a293b5, 0x57c1c76166f89ced, 0x2ee858391ef2cc42,
+      0xa856e093920a72b8, 0x63806a546d033f3e, 0x1e7eeefa55543dec, 0x056ca0f5743c0a90,
+      0xbcd0a4b05c092587, 0x5977f684ad4ff6ba, 0x4fde1ced78e96a59, 0x02750f99cf18d82e,
+      0x332573d63fab5b02, 0xa83429e5be54f062, 0xaee376c3d20111f4, 0x0e103b8b9272ef7d,
+    },
+    {
+      0x728e60a3cda7c735, 0xf1d17c2ca3f29496, 0xeae4e9c131d0e140, 0x0f5a29f9a0942bb1,
+      0x81297b927cde7e87, 0x66a2e0329eec53de, 0x48b0912f52192647, 0x11cbbf9303de733f,
+      0xa79080afd36928fc, 0x6734e40d038173c1, 0xff85e5817c31268f, 0x11007f4f4b29d42e,
+      0x4b20c767b1f723d6, 0x4e25c0b43617a1ea, 0xfb965e9a5400eb07, 0x012ccb96205a184b,
+    },
+    {
+      0xbcff3992623b809f, 0x8f0667f0b01a4592, 0xb6d2761659e64ecc, 0x11a8e5ddbd870733,
+      0x9492d0e0ebe5da4a, 0x09f4cd661862e073, 0x1caefaacddf4a615, 0x27e6fc68891f4c04,
+      0x949c69230bf9296a, 0xaac81c3a6842e043, 0xb2a9d559b340cb5a, 0x22fe123b03b070e7,
+      0x3fcfc9f61045e86e, 0x015f79c41e27b4ab, 0x93272dc1e9eb1fe6, 0x12b75af17eb768aa,
+    },
+    {
+      0x780cc3f1613e86bc, 0xe3a57d5b38d4645d, 0x5d82745bdbfd627c, 0x0241964f9d439891,
+      0x18bfef9fac33961b, 0xe36e598ee3a5110c, 0x945f3be59589688e, 0x13abc0e4c0f4c3e7,
+      0xffa436c41c6349aa, 0x00887c25eb287fab, 0x401a8126face1b2b, 0x2e932b5bb6fecb8c,
+      0xf5911572258f854a, 0x309b48edbbff5c8d, 0x85f74afc62a2377e, 0x11265b21276b1de2,
+    },
+    {
+      0x06008c0413bfc777, 0xe5e1e4636d074c28, 0x44f40b1188a00e6f, 0x2498ebe668a4d2b5,
+      0xc22dc807ee6df42b, 0x20908dd11e1723d0, 0x1be9ffcb75a14e20, 0x1a9338e414a16b0c,
+      0xb677d453fd80a018, 0xb47b07204939449c, 0x4e190bda27a96bae, 0x099c8cc9e07c7430,
+      0x303cdbfafafd3886, 0xf32fdbf2fc406368, 0x7b713d8923c8169e, 0x27a193f47e7cf4db,
+    },
+    {
+      0x80c75e26b98066c3, 0x51c4eff004a5e58f, 0x5af0442973f78e61, 0x1c9e67ecb1e3e125,
+      0x16ee7e840617daf7, 0x61aae93303ef3e94, 0xbb42b070f11f420f, 0x05d785c16d52440c,
+      0xfd9193722d1a277b, 0xc51d2585e18abfce, 0xb37e8762bb26cb2f, 0x27e8629eee2a0cb2,
+      0xa6e827186353eb5a, 0x68a0f332bf80c173, 0xb5570c0a3d43b78a, 0x083695f422e69c72,
+    },
+    {
+      0x645c399f3a5020ac, 0xe5dd5f482a328de0, 0xd212a56067fe10a1, 0x1fbbec379ac4e7f0,
+      0x5e81143c9469801a, 0xaa34c6fbc2dae65f, 0x29393a35a5b32f79, 0x2be60fb6a25fcb0a,
+      0x9704309903c436db, 0x345008307720b352, 0xa3adde702122ded6, 0x0339b8bfabff625f,
+      0x07fddf03beba37e8, 0x4744afb2755150af, 0x1b43bc5debabc99c, 0x1b4376d18b594dbc,
+    },
+  },
+  {
+    {
+      0x496df0a911a11838, 0xc6f50ec929d14354, 0x718eb4bd25299abf, 0x248ad27d6d653d62,
+      0x47c81da75b83ec05, 0x387e54d4474e4861, 0xabb910b4ca519526, 0x0c6676f3a78d1d5f,
+      0xa95e9a9408157e14, 0xa3f2d6056cd15a36, 0x7d18536a6261d6aa, 0x25152c2957a57801,
+      0xf16bd63c50775b12, 0x9351dba221bcb593, 0x2c80db87e8b901cb, 0x134ed66c6f291d74,
+    },
+    {
+      0xa86f312e9323123f, 0xaa60d0d25baf0f1e, 0xba18fc66ecef9548, 0x2bae86dac1e55460,
+      0x8b15baa8376f28a5, 0x2acdfe7e3a87a065, 0x6ba5792e48052a7b, 0x1ca141a57b5ea9ac,
+      0x7865467f3888f19c, 0x91d3aa9c6bc865fb, 0xfab569ba72b81ece, 0x27d2aae635ffc1bc,
+      0x949a848d91bf7c0b, 0x32f5f12673ff42d3, 0xa7d05d75c191b1be, 0x29f1d1f6a14e0f65,
+    },
+    {
+      0x191c13bed6d8ee68, 0x823d10a068f7895b, 0x8050651c5ca0f280, 0x28055412ec07c118,
+      0xa1f82ec268ff402c, 0x308f96216555ad95, 0xed0da721063e60be, 0x2ea81f91125613e3,
+      0x62b9f07a74786ba9, 0xf8a175eba3601f4d, 0x18a7e8cca6ed9ff2, 0x06b60d215a4aec8f,
+      0xde2bbb67871c6f5e, 0xd554d1d209d26a75, 0x0b0080784c612c71, 0x1cd343ab6b97eca0,
+    },
+    {
+      0x319b1b4a15421143, 0x79536a5121a8deae, 0x3d0f1a00d258c82f, 0x288edc389ac99c02,
+      0x9f4a9ccc5a63b682, 0x23c61f4a0c4bd2d2, 0x9323926c09b9d224, 0x22a1e1841d25ac26,
+      0x6a018d40dc279bd1, 0x7badc9b329723447, 0x03933343bf51cb12, 0x1b1add3e1555b7d7,
+      0x51fdcb04d2730f4e, 0x4317b68f1b3a4063, 0xdf1d39b83eb1f50f, 0x29858f7a63a62c00,
+    },
+    {
+      0x3a0b10b1e54a01df, 0x69a87f954e56aba1, 0xde490f1236196737, 0x06ce6fb56c2a6011,
+      0x6626fb3104b9a2fa, 0x403f521be86c5ecf, 0x66a2cf6a9dc8dc12, 0x209bc074dcda9fbd,
+      0x1b7b023b59c9658b, 0x689bfbffb03ca18b, 0xeccbbf56859eb569, 0x0f90c028aa0a7fbb,
+      0x8d9c4eb2e24728d2, 0xd5a9bdf475f350ff, 0x660d870eaaebd100, 0x1feece3d7b5677a8,
+    },
+    {
+      0xd07f3e7b2b737270, 0x00c135f9de96f238, 0xb5ddab6f0a18254f, 0x1756a78e0bc99154,
+      0xdde3c1039baa3da5, 0xadbe5b6aa4a54188, 0x3e0d07611dd41487, 0x2bce49c06225babb,
+      0xc165780d8a534c3d, 0x0ed30cf0dd109a30, 0xd607c00b0ac2d0b0, 0x2cd53387c6fbe589,
+      0x545335f0b379b72c, 0x58aaac0f1c1551ba, 0xda171d44b0559cdb, 0x206eb696e439ef91,
+    },
+    {
+      0x87037666a52a7ba2, 0x46a35039e820e914, 0x2ed10515be937837, 0x2d67974a4c25a15a,
+      0x5ed2f4454eba62f8, 0x51aa6412ddc4a8f1, 0x70ffa44017835187, 0x1e6dbd20fc34488f,
+      0x3f1af7a6651d0564, 0xb5cd61654974d3c7, 0x5b7793ec501a3a7b, 0x18c8520a35b8d886,
+      0xb4244a826d07587a, 0xfe989d87b5589d9a, 0xa9eda2cc5b7d87e4, 0x05b811485e2e6a75,
+    },
+    {
+      0xa0254cba1c752324, 0xba8405ddd513970c, 0x5d5ad0ebd82b8a7c, 0x18c690b98346f840,
+      0x5dc9d317565c35db, 0x36c9e8fd31d94fb4, 0x153991244cec888e, 0x181ca181d536c78b,
+      0x54f2df72cde60476, 0x341228b35bb71ab3, 0x33915a60b7daab23, 0x02598c5233f49efe,
+      0xacd5eed81ba6c394, 0xe04bb49b332dc9a6, 0x6693ea600d2f8ab1, 0x23feefebc6d6bed8,
+    },
+  },
+  {
+    {
+      0x4a6398598498ec4a, 0x1cf99b130eba86bc, 0xde8de3178ad9e323, 0x15db06b6915035fb,
+      0x240551e24243a180, 0xba2b89c102485be9, 0xa591253c8ccf8228, 0x0a6033dc13557913,
+      0x18af506a7e7899e7, 0x815b1e45a8074afe, 0x75ef3f11aa24a4c0, 0x106466284db35f09,
+      0xbd5d6377050faa46, 0x2531e94c7f0fa50e, 0xd700bec1ed18cbb5, 0x2de99137b06bcb1e,
+    },
+    {
+      0xab81a60cffe85fea, 0xe89007b5a9104ba6, 0x5ca5089d988a245b, 0x044256c11539e361,
+      0x6cfd39af551b6533, 0xf8be32091fcca9a0, 0x20c7385b29cc11f7, 0x04dca8b3847533c0,
+      0xdcfdc4c851b500a5, 0x1b7da379a77568cf, 0xe7844ffbfa18234f, 0x058fde050f2ba6f8,
+      0xeb7228888cededa3, 0x72ecc0cd849a1098, 0x536357b1a661a307, 0x11925df9f76e64a5,
+    },
+    {
+      0x2b2fa2cd4abbd5fc, 0xeb673d6f689c9203, 0xa7de6ac1d35a6738, 0x06cb3d737eab35c1,
+      0x84ef502dd202cc58, 0x63d1e3ce3d0be5bb, 0x0e0fad8d0ef9ada7, 0x0773bd41bf5d4210,
+      0x37a0e531c40a71e6, 0x4ab1385166dcbf0a, 0xacaf20f2bc5a39b5, 0x25bab95425746223,
+      0x66b43d009ba152ec, 0x119a1f4c1413ca7b, 0x8275609cd1af417b, 0x12ba450235429231,
+    },
+    {
+      0x2fea991affc926cb, 0x19d5a52b340c167a, 0x631651d9b68c9d30, 0x21bd684311b84e02,
+      0xf1ec2a78da745656, 0xaf318bb94f45ad01, 0x3f4d03fb1ce6826d, 0x02ef360774e0cd76,
+      0x91d4c7ba5a698367, 0x0b2767154f923f71, 0x18823b5e420f4d1c, 0x15b1d536d790a442,
+      0xbb221e921c4238e0, 0x06cba4b7dcd4e64a, 0x76ed63696f9b1145, 0x23b7a54827b442f2,
+    },
+    {
+      0x5aca5779310cad28, 0x05bd3da1afa9deee, 0x46d55b7070336bff, 0x07223764b679767c,
+      0x5fbee8beb7a8ba89, 0x07fde6fda7786bec, 0x8ee96efc918ecb46, 0x2bf5cb732f07caff,
+      0xb31e1ace37907450, 0x2bf939074bb7285a, 0xb2b55ef436e999e9, 0x04ee0dd896ba0132,
+      0x484bb6772e8f93b0, 0xd0912e27a01eb59a, 0xa8d232d45d4528ba, 0x1a43560ae7df340c,
+    },
+    {
+      0xf660bb7bd9b77e8f, 0xb26c253a12486a13, 0x18e47abba4a64fc2, 0x1db23b94725776cc,
+      0x2f87dab786343537, 0x32a486212d8d65d2, 0x3527b7b897a6e6b4, 0x22d0f534630fa724,
+      0xa77b5497e8b30748, 0xf7df4ac3ac80cb47, 0xfabbd7e62f9795e2, 0x2f2cbdb3d80b3a17,
+      0x752cb21f75e5e516, 0x9116a71425b803e7, 0x3f14c2ac045e8299, 0x2216868f8fd7fc92,
+    },
+    {
+      0x2763c5b647442d84, 0x5c52734cc95af91d, 0x2638f80db68ce3d1, 0x08b3f7170457b9e2,
+      0xdd1d69fb3a7e4389, 0x63fda76d5c9d714e, 0x17329d98ee3c21d0, 0x24d25fb6018b9233,
+      0xc025653ec7949dec, 0x0009b5e1ad8d52e4, 0x290d9cd5f37dc8fb, 0x17b00000bc37ee64,
+      0x69646aba07269b77, 0x0ee3f948c5d760c0, 0xa6bc7847480fc8de, 0x22b5a70820058a78,
+    },
+    {
+      0xc0eb85a73e4ce36b, 0x26768f8cdd3e8c44, 0xab1177ccfaaa0ba0, 0x2aba8e4471822a85,
+      0x83547a480f492474, 0xee338bd287ae7307, 0x3d80b7cca6cc1520, 0x06e901bd0e712bc0,
+      0xa66695b9e6e539f8, 0xc5de97dc0a4fe616, 0x74f1d3989459313d, 0x02dd6e0db7cecee7,
+      0xeabf36b6a504c40d, 0x1b1dccf213734373, 0x7c9b91ed1ea17093, 0x1b83587d688c6103,
+    },
+  },
+  {
+    {
+      0x462fb0a555cb580c, 0xceb219027f8b8e80, 0x87c27f27641fa342, 0x2fba21d1554a8df0,
+      0x4632ccfe130028a2, 0x91307f94e79df4cb, 0x215dfa34c7c50deb, 0x0e1a353cfa63c0cb,
+      0x13c4b9a42f9f63f2, 0xffcca67c27157837, 0xfc04fdcb6d0a8dee, 0x16096955d33dcbb9,
+      0xbfd30c969bd5a782, 0xc8c2ecbc8347e8fe, 0x06b4a43bcfc72003, 0x1deb8ca53298caf2,
+    },
+    {
+      0x63b081d1ae04f71e, 0x0420bb9ec6b9d0e1, 0x973a5816f72c794c, 0x08c997f96196a3f5,
+      0x85a02d351fcf0919, 0xec6ca71da1278fcc, 0x790ee44094d4c97b, 0x03bd5700b293c078,
+      0x5a818eb624177a3a, 0x309c69b5360d8afb, 0x90f27bbe754d8258, 0x0be28adcd51294dc,
+      0xafca504bad02256b, 0xe31fcf6ef26054aa, 0x6824805d6ebf9092, 0x2a98f06979baa0c9,
+    },
+    {
+      0x34fa0972703b3a13, 0x88bdc515721e5e4a, 0x043085061dbeb4ec, 0x15841aa30ce063cd,
+      0xe2fa38819801f04f, 0xbc75bc53aaf938a5, 0x9912b459fb5cf82b, 0x109ae80e5ba08ffc,
+      0x9d5971b5ad226c5b, 0xd2131af1586cc2eb, 0x7914cabe245f0cfb, 0x206bcd8b1c00d838,
+      0x9c18ffd833b9887b, 0x909a6c2a0cde55fa, 0x7f0ca1210981dfa0, 0x257624429a476336,
+    },
+    {
+      0xe80776d0814414cd, 0x91373843ae1474b3, 0xc80d882b7f15f030, 0x105b1435d44f5118,
+      0xad0ac51b451eb881, 0x903dca538e7426e9, 0x0d50ffdf45821e2e, 0x15fe71309dc8ed9f,
+      0xa9defbe46e712af9, 0xc713e01310402154, 0xe0906b00ad7a6b3b, 0x05637447e78b9b14,
+      0x03689c4f4c47ff2e, 0xb7a446314d3de907, 0x36be6ee9a2c19e29, 0x1c965caab8e58552,
+    },
+    {
+      0x9e758576e17d1d90, 0x3ca534c8f6161db1, 0xe0280210ec2f0e5a, 0x1995c14b613cb377,
+      0x75b71be76682f07e, 0x1532bb215900c8cc, 0x1294c1a91236c6a1, 0x09d8eaa41a21df62,
+      0x565510a6e0050eb1, 0x7a3bed235ef1c0d8, 0x7aec97b6e7055a3a, 0x0ef4c89d5ec8c6ad,
+      0x5605edafa1537bd9, 0x02afa62f8a7c56f0, 0xc2c0efb05df321dc, 0x0617d1bf69eeab2a,
+    },
+    {
+      0x18bdbc5e0ebffaff, 0x33066aa520040029, 0x686e9f6bef8f3077, 0x1d59f73cc1459ede,
+      0x7766f2a0c46e0c9c, 0x29118c490c5c16f8, 0xdf4a468f9a9dcea8, 0x1cd6687437dcb4e9,
+      0xacb571a892af49c4, 0xd838efed432690ac, 0xc81fb4162f1767c2, 0x226167923617897f,
+      0x32a8e9cb65586b21, 0xae75b0067d496dd9, 0xeee60bd41ac77530, 0x0a22301ad2d72c59,
+    },
+    {
+      0xc6692e7f5f139bfd, 0x1deab09ea4121852, 0x75028cc92351f795, 0x11d5d8bfcd6bbbff,
+      0x8e8b8f51c001c88d, 0x4e62d2ec8e61aa22, 0x3ce2bafe717d5cdb, 0x1952abfe651c9005,
+      0x77efa2479c0eedbb, 0x5aff115ac745fa9e, 0x4268f615377157c8, 0x00ab0d49196322b7,
+      0x7a710415e68dadf6, 0xcaa2f967d3ad8681, 0x49f4cbed9965475c, 0x24e4fd5741973379,
+    },
+    {
+      0xaff1d8b5e4e18be5, 0xf18812e572361b93, 0xca621f84841315c4, 0x0a08924fdeeb488f,
+      0x348170da7dc7d2fc, 0xadb32357636aa16e, 0xfef3bd7e8c0ddf59, 0x1b2af7233ceb5dc5,
+      0xda7f8cd388dfe8d4, 0xb88e53c51171d93d, 0x04ce17561bc15409, 0x21345e86e6ebea43,
+      0xffbc6d9ac247bd87, 0x32c610015407edef, 0x908d48a1ffc1463f, 0x01a97f6f99245ebd,
+    },
+  },
+  {
+    {
+      0x818cf8f7eae422ab, 0xd304018e72de9ced, 0x9e88c73f987e78c0, 0x154db5f4d3a1c6ac,
+      0xee1997e569da1580, 0x8b40f7a8e6863042, 0x8e84e586a2b67d11, 0x1dbbee448099f067,
+      0xd1b53dcd0784f745, 0xcb84afcd94a2f2be, 0x76dca548551d4f77, 0x2c2286d03ac9ca78,
+      0x38c052def86dbf61, 0x4cacf13f9f698523, 0x5ac3049bbe4196f7, 0x12f91557bfe6da5a,
+    },
+    {
+      0x75f747a2ffd18a76, 0xc0bed1fc45200e58, 0x0171814453b216a8, 0x22c50101c3f96452,
+      0x5df3c682636fcf21, 0x8f6044f40d566b7f, 0x2de7facc9c6e76c7, 0x1d981d03f24c5a07,
+      0xb60d70f49e154de4, 0x097487e352f0b177, 0xdf06d5027ee4d9fe, 0x082d8052548861fa,
+      0x09a790208b6112c0, 0x1c79ad05c3eac8a5, 0x85e8eef490448899, 0x1472d92668d0bada,
+    },
+    {
+      0x595c193e2db8180e, 0xf0a652eed832a804, 0x56002b21cf8ade50, 0x221b78c85942236f,
+      0x7146901d70cce8f2, 0x4c0c36cd81c9db33, 0x28aff701d012e042, 0x020c3eca5c5f0187,
+      0x13064598f2709393, 0xaebd416c73e9b368, 0x2ff21567a980e920, 0x19fa99f6d774a908,
+      0x3a36a547a8e58e13, 0x968e6cd3cd5b0356, 0xcf942655f89c7efb, 0x2fc6c5ed7ce3e260,
+    },
+    {
+      0x1649b27f006b1a03, 0xcbca32ef1986400a, 0xce28e973f34ec881, 0x1f47b8291a55ccf2,
+      0xea65444aec22f779, 0x83e924b086883497, 0x750a9a140442b13b, 0x1b812fbd2c7933c7,
+      0xbbd312fb3e2b93ef, 0x4afc558087773069, 0xa9fac24f4a4439ee, 0x2bcbdb39aee8699c,
+      0xa61516c7bf9fed80, 0xd09025ea12771df0, 0x31ab453aceb90921, 0x1e4763d7ebd4f528,
+    },
+    {
+      0xebc01b1ba30336de, 0x670cf1cbc56fe83a, 0x43b7e5ee689a9abf, 0x04d2ba70195d5ce2,
+      0xdad1665de4d88c0b, 0xa18306de403c4f83, 0x0ab62fe6633cd64d, 0x2270c1d88758a24e,
+      0x8f13ee22714392c2, 0xf5046b779edd80fb, 0x335b4091f99f650b, 0x1c550271d2e84e25,
+      0x31f8681ff4f3ed31, 0x3a77ee0043028159, 0xe88ca4800a075082, 0x1c11eb23fe0378c3,
+    },
+    {
+      0x855f0db5ac5ed6db, 0xa76a03312f8837d7, 0x433f1e184ff627d7, 0x02970e5af060a88b,
+      0xa15415b8d70627f9, 0x9927324e0449fc80, 0x14c116668d15e612, 0x270bb885821fcfd6,
+      0xbaa69dc7a64aa6bd, 0x2668aff27a4bea29, 0xd501f6500fdc7def, 0x12ba8192af6f0a31,
+      0x2975e11899517ea9, 0xf326a65c8c75270d, 0x79e9352a00221fc3, 0x0c3d4b49862261c0,
+    },
+    {
+      0xb3573ba8a8f9b5d5, 0x16e621a13df7be30, 0xbcfa5206031cd080, 0x00972ead774fd93e,
+      0x00d5e01c57a6c7e6, 0x542c0909e2aa5be4, 0x3eef90e15388e6fd, 0x0e2ca8bc6ec8c006,
+      0x64b4c3e92619e229, 0x804826e4c1785d9c, 0x55ddba07b492716f, 0x26ba8f7522de71df,
+      0x35eee9f1c89d336f, 0xa604b037e5f84d74, 0x89e706f02e426509, 0x062313faeeb6ac91,
+    },
+    {
+      0x9f8f80b9caa70c52, 0x960b126a653cc061, 0xf4bd63de56ab6d38, 0x298bd2c6d5f81b61,
+      0xe6f9d156bc2a1ac3, 0xb9df7cf2b1490af0, 0x993099b1fed4b3e7, 0x1268bbe4a88fe573,
+      0x9bc0ff75bd1aa547, 0xc52ab0ba27da43cf, 0xf01b50deaafcd153, 0x0bf813ed47cba7db,
+      0xd59bb996898e046d, 0x9e5ac231708c4852, 0xdad988dbf486be42, 0x20ea0666c21d6498,
+    },
+  },
+  {
+    {
+      0x730fd0e0fb606c8a, 0xf89072a07434354d, 0x42e2f45d75060578, 0x18133b8be11101ec,
+      0x933ee3aa833ba327, 0x9c459adf99419a07, 0xea172bad15ca12d8, 0x0d92e8d94db14eb0,
+      0x1ac51b34eba09a81, 0xd3d359ea0b159c46, 0xfe99732895663d13, 0x2c0c76eadc93c932,
+      0x75dd0de8f6eb1562, 0x3ea7635c69362f15, 0x1030f73dfdf2a6c7, 0x13cc5dcd1735cd3a,
+    },
+    {
+      0xe03a6c6fbf6a9f6b, 0xe5b9316123316816, 0x4debb0e1f903fdef, 0x27bf1592368633db,
+      0x88b83e6988d135bf, 0x88dfda2c53cc068e, 0xc4b7ca5324063179, 0x2440ae7308595c55,
+      0x0331532a890dead6, 0xdafc4309005ad155, 0x7f84b97a8964f601, 0x0115be05ceb45055,
+      0xb6b4cc03d80a6152, 0xc62dbcb9e4806b3f, 0x3c1478f5bd9c318d, 0x2f1b19858f995390,
+    },
+    {
+      0x9c7a52dedf2a8fde, 0x89e753f0595b26d0, 0xae11fe0f371fd45c, 0x2fac2ef25de418fe,
+      0xede46ccdeefa477f, 0xcea6f9c5d71e9fa7, 0x3fb6f0cc9daf21c4, 0x0b3c6ebe58490518,
+      0x23dd108a412670fe, 0x69aefcee7be29e8c, 0xec9de73711a95d89, 0x064a466262196995,
+      0x65f5836c4edd1bb7, 0x0b4d50f5d46a94c0, 0x292303223ec1e409, 0x1a0c4579a337e047,
+    },
+    {
+      0x7308c620b825b20d, 0x6d3163b35d55fe46, 0xade44478813f7344, 0x0d294c258a33e33a,
+      0xa7f81784735ad7ec, 0xff9229c9de7e612c, 0x12e10a2437eaaa28, 0x2be48aa643b1ca53,
+      0x4d49106ee30cb8a8, 0xc7e97df78ddc0130, 0x1517c6d4661b1c86, 0x160bf9a42518e502,
+      0x21d5f81855779059, 0x8e590821d9290688, 0x137034c24c1ebbb8, 0x1c2627ed5d9b0c6f,
+    },
+    {
+      0xf9e3a00da11353cd, 0x032dc9e94692571d, 0x72565e112f469180, 0x19104fe8247be469,
+      0x9b71967d8f8b3562, 0xa4a1e4721ea32fd3, 0x112d5428b17ae936, 0x27b7bcce6720c75c,
+      0xda3dbdf1a0694556, 0x404b227a9dfdcfc7, 0x2f2f5f1ff7290190, 0x13d23bc14c13bf82,
+      0xa0aafa6866d8a7c7, 0x08ea5c035c3367d0, 0x5f21e88de8b6bff0, 0x02d8d9e0969b7f3f,
+    },
+    {
+      0xe1005b35ace8f994, 0xd3afbba4c2f9676e, 0xaae249195295f66c, 0x13b1cac5a01115f7,
+      0xbdfa25bada94733e, 0xdd06feec9695e984, 0x31130df479e4ab91, 0x22fccdafdf482d6d,
+      0x8848439e000d2c3e, 0x430e283ea58e1c4c, 0x8d572751eac6afc3, 0x1367c658ac7804ac,
+      0xb8ce4927756e0c1f, 0x556273895aa2910e, 0x77f572f83910918f, 0x0a13c3ce325eedbe,
+    },
+    {
+      0x1c812c8f80da731a, 0x46883e6dfde580f2, 0xc84024b5b3459552, 0x21c0de0f9249709d,
+      0xa6d68fa020e42279, 0x10fc284de4959536, 0xa5599f20d6630978, 0x265b9f1db6faada3,
+      0xa12e8f2fd0bad91f, 0xa98aa82672183bc1, 0x8421e2b9f29e9f10, 0x28b485d3322faecc,
+      0x039ca3240f4e39c5, 0xf5d6b01a43ca0d6d, 0xb846676fba8a8667, 0x18af764f91ceba6c,
+    },
+    {
+      0xf24ebca39888c6a3, 0xbc3ef409c614e81e, 0xd3cb0556462e85d7, 0x2b41a88e898b0a87,
+      0x912633955520f9d9, 0xfa6536031f584b22, 0xca95d33404695a5f, 0x14f9b488fb059a48,
+      0xae70774263e65425, 0x692f2aa99b06c14b, 0x9b89327bb96f6619, 0x2b6eb3cede51c0c5,
+      0xfc11d1ae774fcc04, 0xed43a6f6fe2ce77b, 0xb1aafbe3b4a6f987, 0x0d48bbdaffa14b5e,
+    },
+  },
+  {
+    {
+      0x54b169336d99092b, 0x879644c082f40ace, 0xa7035c49d8c25e19, 0x283f42a0efec5d0a,
+      0x255c0e2f841359df, 0x73c2a6dafd595abe, 0x5efd2b3a451c9f95, 0x221eda017e3c2294,
+      0x634d73c5e429cb9b, 0x2e94e05635ba39c1, 0xdf23e238437d32c8, 0x209b7a58ae700748,
+      0xb1161ebfc8b602eb, 0x4749813c8e3f9cb1, 0x9c771d4897d17f4b, 0x28993cd66a5d2474,
+    },
+    {
+      0x33e6d81fa99f2fd5, 0x5590611e328e298e, 0xeb5d3a5422f96a66, 0x0b715564d6cafba5,
+      0x85c00b1fd2c895aa, 0x71d4176fd37567ac, 0x1d498f0763765787, 0x0b2a7e3cb877cea9,
+      0x736edc146d83c673, 0x3c3479cd81305c03, 0x3ee3fccbfe5113ee, 0x28f7f070e089fe6c,
+      0xfbcdb1c45b328e8e, 0xf9caad46a5276440, 0x69921f23dc899694, 0x1d95d7e9c396e9de,
+    },
+    {
+      0x0c738fca6332f816, 0xb59279b743723665, 0xb0f4294a157e5307, 0x2307cf8d3455c38c,
+      0x08514767ff71c7ca, 0x12333ce7ff1e25e9, 0xb3f20495ce32a08f, 0x11851f87a9b27ee2,
+      0xbd82fa71c2cbf82b, 0x8833a3317e40e1f2, 0x6288727e4d6bc450, 0x0ec3709fbfc39995,
+      0x926d40754cef34ac, 0x1cab5e954598856e, 0xe740388397b24640, 0x1cf90f4447198da2,
+    },
+    {
+      0xf836b5bf1d0435cd, 0xd8664e921b4d0b51, 0x29a7948970dcadb6, 0x0f543a4875ee79f2,
+      0x306b89a830610743, 0x7fe5c8a09365ce8e, 0xcb4edf164f9ad4a4, 0x0b39112e98f1ef07,
+      0x4933df105669e7ce, 0xe7a7f0a92355e8d4, 0xa47e6b4590f81a06, 0x19c8bc3354c27ccd,
+      0xf994e5e11d568155, 0xde47f39f71d2b168, 0x7fd79d9fd721bb4c, 0x22c2d188c289359d,
+    },
+    {
+      0x6e5f8f59ecedbfb3, 0x9838d90bf1985ba4, 0x1d06148040b680d8, 0x1827d5ff4e4b8bce,
+      0xa5104a57ea2dca91, 0x4bb2a2e2d9a2f843, 0x8b84888d92fa0458, 0x0c00664894d28daf,
+      0x54d7233c5dc80733, 0xdab79c77cccc3257, 0x3c968efb12c51319, 0x1a2a72cd1abb261e,
+      0x4d18914aefa087c7, 0x3d276dcf5d8ef74d, 0x08355fffb3028872, 0x2d2e3ce36bf13e16,
+    },
+    {
+      0xeabd87bd7f5f30b1, 0xbb10e40a6b843543, 0xfa79e10b922d28b8, 0x2660fe6c18e856db,
+      0xc8b204d7003cd795, 0x2578856573fc6a7c, 0x40f30d0203454660, 0x2fdfc75dc79d9292,
+      0x97fc23cac7586a56, 0x872b0a7f07c6bf01, 0xf2823e6cfe629157, 0x1891bc9c5b207bb2,
+      0x410b93b99914f565, 0x0924c69ce742b4e1, 0x8937d3ff38e8fe07, 0x0baa46d3775546c0,
+    },
+    {
+      0x17ae0f41922df028, 0xa8c733a5e6b03608, 0x9d60d37f592e6597, 0x0c1df3a685a7ab8f,
+      0x6fe7ac256ffff938, 0xd921be0f23045bcd, 0xeb19358a234efa86, 0x0dd4b84473f160a7,
+      0x80ebc6f1e9b6e765, 0x317691138b4a7429, 0xd39c43b2016e2c50, 0x2c98f581e46d8e25,
+      0x5c8f91bfb5ce7c36, 0xd3a42d22e9460848, 0x1b57dffbfed1c7ef, 0x18c9ae2b4eee071f,
+    },
+    {
+      0xbdcb05e61d6c8826, 0x41a7bff3fb1d7c87, 0x54f4856884fb0145, 0x012b72ceb1dc2a5f,
+      0xaaa6aa3cea516dc4, 0x8ce6c2017508fe9c, 0x86126dfcd9f69ac7, 0x16c8a624a2c5510a,
+      0x2eb19251f2733ca9, 0x68394a4d2e914a6e, 0x0eb1fb981d681701, 0x14e1f1798fa8c5bb,
+      0xe1e16944a16c3544, 0xaf1a77b209012a81, 0x47fa40e74f99f7a7, 0x0cc06ddaa77ec513,
+    },
+  },
+  {
+    {
+      0x7855ee8130dd12b7, 0x6e34de47a54db287, 0x6ba6bb0051ffb893, 0x050119e2a12fd588,
+      0xd379581e2717dda0, 0x2afc90083af93575, 0xbffe14cff51ffcc3, 0x2492693b1d853f73,
+      0x853f4b8ebbfe7ad9, 0x65cc79fbc0b1d9d4, 0x0024e34bf28ef2f7, 0x0b811504173d7658,
+      0x73ea4c103e930039, 0xae4bfe88e05619e2, 0x2738d140830de6ea, 0x0bafbe61a56b54e0,
+    },
+    {
+      0xe048815ebfd1858e, 0x779c3bb20d69e9df, 0x7e80d0651fd6e741, 0x10d60e90acfa9357,
+      0x6478817019b666c5, 0xc3d80a4818c26d44, 0x13b679cb999aad9e, 0x039e47be278cfc91,
+      0x01cc133d3f4060aa, 0x825107930dc825df, 0x237fdb6a5825eb75, 0x29c9169eed3cc474,
+      0x87961eea9bb05f73, 0xa09cd3c737b0f1f2, 0xedf2aa92e92c81f9, 0x09114bde79efcfe1,
+    },
+    {
+      0xc5d927d305cef647, 0x807d4678d213dedf, 0xd27419a57f48a7dc, 0x224b35239f86fc18,
+      0x6d8243ab202efbe5, 0x818c80a8c4ef082a, 0x13300319e57d80ad, 0x13a60f5d9a2cf8b3,
+      0x6d11bd45d07b5669, 0xd698abf0a2cda776, 0x745e8560e5f66493, 0x2570f918fee9397b,
+      0x89c3463253dd92fc, 0xb3583f6b2ec3666a, 0x61ca24034a0bf7b3, 0x0f2e4321d045af7c,
+    },
+    {
+      0x4d18a97ebbc0b775, 0x47c94bb7d1d0d867, 0xb2f0458e00cbf647, 0x23fde2ed81083734,
+      0x5420855ed7147d06, 0x30f1324e82cc7939, 0xa37b12a30f5a37d2, 0x0ecdebcaa8599232,
+      0x30164c841b94d485, 0xa31198c2f218bde1, 0x2ee2a84890de4108, 0x2bd6b97d47cea3e5,
+      0xa2dcedf40fbbd67a, 0x6ff10ef19b91683c, 0x8ff061f792737233, 0x2b4d7ba0c99f548e,
+    },
+    {
+      0xd632ec50d9209167, 0x9ab37d447666f2bf, 0xd3f96e8fc35952bf, 0x037a0bacf2286ecc,
+      0xdf4ccc482d53d2d2, 0x4456cd1751b3fc0c, 0x9d9c3a02c9b58f71, 0x08cbcb8a58370768,
+      0xb890ae0becb81a8b, 0x4d46b9692a6bba24, 0xf049566a4db0c55e, 0x07f356289f08b2f0,
+      0x121c64396ed16955, 0x7f692b9a19524ba0, 0x4b3ca834322f723a, 0x193e307d54f54cba,
+    },
+    {
+      0x1f1e6a5d4670342c, 0xfc5ae29f45018854, 0xd0089cf94ed527fa, 0x056713d4d1b0b17d,
+      0x64d5ce8cfee42d54, 0x61caa07793ec3fa8, 0xc2525d4a1cc97973, 0x16a3251f38164498,
+      0x009ad7446588be88, 0x38dcbfa7474db753, 0x84d1b2c26b9b3ce5, 0x0d5b61423996cad5,
+      0xabdc4ddea94243e0, 0x6a41fb89a857df81, 0xbd0fee12997105ba, 0x09521c6670391ac2,
+    },
+    {
+      0xf09d941f18924d28, 0xc41f4552192787c6, 0xb500bf35009c0363, 0x2a8747ef36253c2d,
+      0xcd6daa7740d5deab, 0xbf044512c9a3df00, 0x593631ba57708309, 0x09fe9a4d682de443,
+      0x2622827fbbba1bf0, 0x26a1da746d1f6eaf, 0x5e5adb9f9c238bd8, 0x0092803e8b094b52,
+      0x6ca1a888e2cecdcb, 0x3b17badb6ff5440f, 0x280dcd80588efc83, 0x23200b68db829e47,
+    },
+    {
+      0x09218c3d4fa60939, 0xbbf0a120d00fd7e7, 0xf10e1e8a2e64fbd5, 0x10a195ef3334a937,
+      0x533c52af634e52ee, 0xb58cc6d980c8b2b2, 0x9dda447a6399cc13, 0x12f53c88a3151ec0,
+      0x4892b0621fff6ad4, 0x00856ad8d0257956, 0x141254a193848109, 0x0ee8bba467f7c0fb,
+      0xcca8dcd3419e1977, 0xfe181f866cd0bd64, 0x14c93c260d7e7e39, 0x1c569bbea456e37e,
+    },
+  },
+  {
+    {
+      0x888df86cc6afc35b, 0xcbd435bb28164a70, 0xfcf52d102cf9e651, 0x058523cd24c492cf,
+      0x24009141da5e3779, 0xc622e6f36db67ca0, 0xfd57231d08b04c3c, 0x26d35aca27693a06,
+      0x245786bfb36aa8d6, 0x053f672bc046a727, 0xb833d11c6221b09b, 0x06c5259b30d2f1a3,
+      0xb9da4c3874fe5faa, 0x5d1796d76bb0b1ae, 0x6e7b514dd0cc9386, 0x0af2f13c520dd5b1,
+    },
+    {
+      0xff8c3c4e418dea64, 0x3d6ae5c66607a7e9, 0x93474b072fb309fa, 0x1f33d979ff1361bf,
+      0x6a76d21c4d03b84a, 0x6e04ff142ee4618f, 0x8b17589725e56a4d, 0x24987d959f17f8ae,
+      0xd6be8a64befcb326, 0x418cac6ea4d8c9e1, 0x41de79d187fa4085, 0x068ecd9c8d8f64f8,
+      0xebc6990fcba2f933, 0x7b4cd65a0c4b7f9c, 0xfdcae49d28972029, 0x012f7fd90c11e152,
+    },
+    {
+      0x415ef63a64cc015f, 0x2faec40ac0f09518, 0x2a84bc9ed930ad29, 0x207f4de9f535a352,
+      0x4e63841b1b3d785d, 0x017bd94460e6eb2a, 0x32f95b70a873ac29, 0x10dc00b769a6c0f3,
+      0xbc522d6882eb490c, 0x8478ffd9b715edfa, 0xf05b0eb278af60b2, 0x0006c69238c0e81e,
+      0xe2eae4722f163ffa, 0xf84580470028e192, 0xbfa48a2968790c15, 0x1ab898e8b54978f7,
+    },
+    {
+      0xee864d6a765fa62a, 0xcac7bd30abe30fc5, 0x825f83eb8f8ad66b, 0x28111d6cae7458ce,
+      0x9ebfbc96d4f0bd25, 0x9a3ffb407c48f023, 0x8c392d8b5d4fce3d, 0x296127033dc56916,
+      0x80f44e64609d14ad, 0x12a547676b1c0702, 0x19293c0f5325889d, 0x17ba51d61af995a9,
+      0x3a11ac70f3dc2748, 0x7a6d2834412fb111, 0x8e4a6d2bce5af14d, 0x022e1f72a89c2e2e,
+    },
+    {
+      0xf5592059fee5c623, 0x4053e56dcc7c1d7e, 0xe085763adc1f9204, 0x073de8b444bf5d6d,
+      0x6462e04e19f101e2, 0xf82a4e9fe31bd2f0, 0x305cae931f5f3850, 0x061b07e01e552426,
+      0xfa5cf28c866f5411, 0x9d96aa7d3908768c, 0x5e120730749333c5, 0x004bce4c8534c6ed,
+      0xb3cc799c887faaba, 0x2e42a90cd611b82e, 0x63f297859a153b09, 0x03a8fd272921c0ff,
+    },
+    {
+      0x1afeef468f3e78e0, 0xae887d0b5eb1da87, 0x42df5931e71d7ffd, 0x0055d7639b4e613a,
+      0xa9f13c7bacbfb24e, 0x848927b9b8f19520, 0xb4a39b78d7cb06c8, 0x045e4f2a65b59acc,
+      0x6f598a28743f0bd4, 0xc3f0fc6a5936af18, 0x7f576d5c8e807648, 0x080247d7261a5c43,
+      0xe4913ba73ca88d8f, 0xd170bc473a33ebbe, 0x8f992360e686b520, 0x0749af1452579622,
+    },
+    {
+      0x36816c899d4a25be, 0x0d0ef269b227d596, 0x60389396b2602956, 0x1bad875fe73189bc,
+      0x04776a2232463f1a, 0x91569ea3f1decbdd, 0xc1c02a6cf5117bef, 0x01c2a4bdd8474748,
+      0xb8442f07ccd8a444, 0x42f784e91ff972ef, 0x6d6c4e11e9a6b7c0, 0x06d85d732142fb70,
+      0xca428ba96f49e033, 0x0fb6cca057a5864d, 0x50b70ed86647718e, 0x28064de3afca0b63,
+    },
+    {
+      0x512f7dcabe014a1a, 0x70d0e68311d52041, 0xb4455b61dc20d06b, 0x25aa90835c2bff50,
+      0xaa047374080f73db, 0x36c57ea963f5f2d2, 0x70837c5ddbd6fc58, 0x1ecd69749aaf4ddd,
+      0xbb25fb6d60963f0f, 0x7e8882e4bf85f8dd, 0x65a3797c65cff687, 0x1e2b3d4c66fc1216,
+      0x4b6185dbf25e21b7, 0x7a7b1c4eb51d3099, 0xf0c63db64b0758bd, 0x0a036ca424ac681f,
+    },
+  },
+  {
+    {
+      0xe9687e43e04e12c3, 0x2313b86f3eb870ad, 0x1f146acd7ae0c93a, 0x179a45a69c8836f4,
+      0xdddbcb39fd4e1246, 0xc0fd13945597894a, 0xeacbf6cde9f3c287, 0x2945a95f8a408394,
+      0x8909c8a49b0fd06b, 0xd6cc0425bce78ccf, 0x3a6d1b4c8239ccff, 0x01a807d3219098f9,
+      0xea330f49e85dcf34, 0x9f490a7cd9580fad, 0x2a068c0d9f9a2420, 0x1094fe6e6f194b2b,
+    },
+    {
+      0x943ebf3de25c2487, 0xd4178f3f7f625ebf, 0xd28a8816a2191db6, 0x1171ee33bf3d1858,
+      0x1cedbee9e2f8e104, 0x3f91bf98256717a9, 0x246fe29ebd854cae, 0x05594ff67dfc8457,
+      0x9bc6eefb7c97a7a9, 0xcda8138f5a1431b6, 0xd0ea24d322df2615, 0x23c8bd173a98aa53,
+      0xea8c657e509fcb3c, 0x88a92c3ce4f5c085, 0xc9889d3e2178253d, 0x0940dd1d04fa43c4,
+    },
+    {
+      0xe340ece0c375e77b, 0xd6ea2c26c52a4625, 0x078b80c452ca9d6f, 0x1decbb11feafc20f,
+      0x2e5db601b556e5f8, 0x04fd44a04662a05b, 0x2a1ac2e98d90807b, 0x20f6ca94b3f8bad7,
+      0x2ad8dde557dc8305, 0xf740f50ca3caecbc, 0x6477e8f29be67650, 0x04b4273cbd9b15ba,
+      0x077b66c28233c282, 0x5c1e3198c1e2da62, 0x9b2798590c981125, 0x1dbc44965654119d,
+    },
+    {
+      0x62174b9cfec006fe, 0x4b90b1a06b5422c7, 0xdf6588a8a194837d, 0x0339f7e82a3bc1fe,
+      0x51b277e8e71aef9e, 0xbf9b630a1d46fe93, 0xd721ab8b63e5ab34, 0x1075274dabcea3fc,
+      0xb726ca474c5346a8, 0x49526cfd1506c210, 0xd091385b7b77ccfc, 0x28697b74379fa37f,
+      0x6df7dc67718a0aee, 0x6ba525d4ea74ce64, 0xd54940784800d72a, 0x1d709042a06f1857,
+    },
+    {
+      0x5fcc5b54feb82ca3, 0x0ee6a4d9f1707dd7, 0x32392afe37bcb78a, 0x2a2fda5075a34051,
+      0x785e79b63a73707f, 0x881cdbc7ec50f4a6, 0x5dbc9bf8e2af37e9, 0x0689fcd77fed2f61,
+      0x0bac02db4bd2878f, 0xbaacb9bcd58ceb5e, 0xa2e3828987d56421, 0x2dc1bbeb4c58b2f2,
+      0x0cd9e895183207eb, 0x4d3b936a9acf7bc1, 0x66081ab094b28035, 0x257aeab0e86dc15a,
+    },
+    {
+      0x829a82256b15cb08, 0x448f336f4cf16b88, 0x3a49f1e70bf79522, 0x2f3dfb00822becf8,
+      0xc589ecbf55e415c3, 0x1b9aba1c56c67909, 0xa331d249fecd5876, 0x262b316694cb35d5,
+      0x6e6d1d1ac4c610bf, 0xeb5fd90ca4ffa679, 0xdff69127d68448ac, 0x2e4ed21394514c41,
+      0xc7d45ae61d7f0f13, 0xcbeb8741b51d315f, 0x201d2b81db73740d, 0x23099beac565dde4,
+    },
+    {
+      0x8eb572642b00f2d4, 0x68836a285db32de6, 0xa1c78dc4e0ecbf03, 0x280a86fc0d1bbac8,
+      0x7c3dc20aa80d929e, 0x71d99d15fd19e5b6, 0x83c8573a8e3b899f, 0x2f4805015c1ab963,
+      0xec8e7c7803f0101f, 0x6b19b10cf638565f, 0xcc2d6dcf647d1157, 0x1bc9a449d2121ed3,
+      0x64983117515832c8, 0x5bc801f76ba935fa, 0x4e2d201a9caf6ad1, 0x1136ed2cf0b86b99,
+    },
+    {
+      0xb8c78d99090092ca, 0xe120ae72dfe12131, 0x82a513305968f4d6, 0x2e1b6bbafbae77dc,
+      0x543577cea9183ce6, 0x83e7d27d3b062c4f, 0x7e34a168f29bc23a, 0x0d3c2986d8fe768e,
+      0xd23a55d5c497cfd6, 0x82a56a4d3edc6106, 0xd26d5867520be966, 0x0de49ea7044a0a5a,
+      0x60a7edd38024a396, 0xe654c9c980f0ef61, 0x587d96597e577a90, 0x24a01ca1103e6771,
+    },
+  },
+  {
+    {
+      0xdf79a76cbfdeba18, 0x044badc458656fd3, 0xd6e5360ac074d5bd, 0x171d57e905df04d0,
+      0xccb3c09a30101463, 0x312f87c50f9c5f3d, 0x236bf0a914cd3a16, 0x2e411101200db02a,
+      0xa273e7e6c002c477, 0x928152193e31ade4, 0xfed32ada8c9b9d96, 0x20a9c5ef2a7f3da4,
+      0xd34791058b25f1f1, 0x4366b5b0e64324c1, 0x2115a764e830c991, 0x2f13aee105011916,
+    },
+    {
+      0x1e544e4ac53279a8, 0xb78b722af24eceac, 0x4927644c11891a2a, 0x1d12e42ba5fd21f0,
+      0x024ea7aeff2966c6, 0x86b3bfe7f225b6c6, 0x63d43ce723cecc4c, 0x042a1f30dd312c47,
+      0xed9c42b3e5db52fa, 0xb0762970ee53b106, 0xdaf6bd6a70ea5bfd, 0x1f32fa7ee1eb2079,
+      0x712cd766c9dc5ab7, 0x742da7ed28e02dd0, 0xec3a74754d2178ee, 0x286d1820dea2b684,
+    },
+    {
+      0x122c210ce778688d, 0x87b41fe522b46b52, 0xfa822cea968248ab, 0x1d2b1e8248f11009,
+      0x393c53644a83cbb1, 0xac5138b686584e71, 0xa35f733d6f94d6c2, 0x181710b7ce67f862,
+      0x6beaa3e2baabefe2, 0xf7e0dae80350706a, 0x4ac10e67ae8e6f17, 0x2da8c66f275e3337,
+      0x347a63be6f551adb, 0xa2dfd323f0a599c3, 0xf288d7d92a7310fe, 0x036de001d62f2395,
+    },
+    {
+      0x4f5992f4ffd9b6ce, 0xffadd4888aae59ca, 0xc330785b503cac7a, 0x1ac018df0a0e3c84,
+      0xd9d5479407def6be, 0xdd78af87c7150e28, 0x207cbb0d3c1b86f7, 0x19a00fcca4b717f5,
+      0x7355861e2eed45e2, 0x665a0b958ac207d1, 0x766c7eccd186a5fc, 0x2fa55dc549bacb16,
+      0xd2f55fcbf8ae96d3, 0x658bbc6819cbb3ac, 0xb9cf49999be7a51a, 0x2c25810312b8b0bb,
+    },
+    {
+      0xba9964cc0d837eda, 0x2b347fade8e1d9ee, 0xacb006e5884cab1f, 0x2f4d543f1e6b7d68,
+      0xaa1c4288b4f4b72f, 0xb5ea48348a53d508, 0x54cb0c8f85ed1730, 0x06e3e3609573adb6,
+      0xbeab9c229700a668, 0x7725dbc6b201b1bd, 0xbc6e651f60a45d0b, 0x1b2ae391c560032d,
+      0x2d77e525c38a87ad, 0x97749bdcaa6fb590, 0x76ea4489d126fb21, 0x2ff4d017fbfccc41,
+    },
+    {
+      0x7c5e81cb79b4de08, 0xff7e9f1b0f04bcde, 0x69ccf4b6308e4621, 0x0d22a6e979b5d95f,
+      0xfe102f4027e1c861, 0x117291a7d9b222f3, 0x51a92cb76869e167, 0x18f56cc6fbed4192,
+      0x9a379cf0660c7a88, 0xa89105316a68e758, 0x30eac25f744f89ab, 0x12f5a513a7e422a9,
+      0x39d18819fb3e96e6, 0x085ada115212c182, 0xb609af4190fe5556, 0x28acb23870faa672,
+    },
+    {
+      0x0d751443ae70f405, 0x0fb902c770ada16f, 0x07cf901d7f3dbc53, 0x0495256d18d5b0b0,
+      0xfc2731b119a3c06a, 0x47d355ae3543c078, 0xc0abdf6a96132dd1, 0x06388f666bf0ceb7,
+      0xcb4883f72b56783d, 0x9bea4a0d7f3cfe52, 0xbc358e1e24b78cb3, 0x0793f876e3e71100,
+      0xc76bccd6cdb24e24, 0xc8f024f90711b516, 0x3e1d934b326a9113, 0x0aab22600bc6c4a4,
+    },
+    {
+      0xb1f6855aa8f6e816, 0xf95febde85f8b951, 0xa83745a6b3ba8491, 0x152fc8b3d196ec66,
+      0x8cadaa5c7d69be91, 0x8761cd036a03bc40, 0xa5cad7747e2f36bc, 0x1ccca20dfbf02f6a,
+      0x4623a1b622195486, 0x2a1ffbb7e8573845, 0x558ecb7f04be8e5c, 0x0754698664d8bbc2,
+      0x6604e0e2d3eaed09, 0x810bc1a72b31bc38, 0x6e5ca0fef43df373, 0x16b356748836ed11,
+    },
+  },
+  {
+    {
+      0x53aff75c06772ff4, 0x59b4aa49b531288e, 0xb243b578a0423863, 0x00fddac6640241f5,
+      0x5e7e315dcfeb5213, 0xa263d2009359a569, 0x205391bfb1c6b1a7, 0x2358b4ca2b6da0d0,
+      0xa43d69814aae6ca6, 0x3ac424c40e371eb7, 0xc1cb044fe1d11c54, 0x08c0590cc6d260bc,
+      0xd3f0b0b4bc9a5ad4, 0xcac934684f14dc34, 0xac18010ece33ccdc, 0x2103d6dcbc3b4ccf,
+    },
+    {
+      0xbf57824be642451e, 0xad6bec7cae47f76f, 0xd9c435f420d638aa, 0x218299cec0269d57,
+      0x98292b482f8dd1a0, 0x87c12c2fb5a085e4, 0x684226c23107a015, 0x1d61a63304282d42,
+      0x0db38cda6454844a, 0xcf1638244b9b9894, 0x88b4b97b8d83dea8, 0x232591e0f11a4ab3,
+      0x707c2b33fa438670, 0x396ee80b22800e72, 0x2c6fa22783907b98, 0x1cc365a8cba3eb91,
+    },
+    {
+      0x244405f85922a627, 0x7032a59d110f71b3, 0xcc2ea2fa427a228c, 0x02c3921d21c1b397,
+      0x07b80fd41e9ebdb9, 0x430357fb2232c77a, 0x0bace847dbeba0c4, 0x06f65c322b499441,
+      0x2c0cd38ae96ba6aa, 0xdab783e09bbfa8cc, 0xd7a927c3b4ded19b, 0x19e6ad10018c66e8,
+      0x571a45378952af04, 0x50c410f32ca1b844, 0x2a6ad95e04af5655, 0x1cd2bb16c27d11ef,
+    },
+    {
+      0x0e36ea646ed0a631, 0x4ccacbb1a83b2688, 0xf88a57622f328d64, 0x0fff975c0c8e7bda,
+      0x72e5fc4f9ee1e77a, 0x96ad0246627a6fe7, 0x8ce9a7e467fa321b, 0x0c036efc4a4241db,
+      0x23cf6cd26ba9f48b, 0x694b41264734766f, 0x72e799637e2cc666, 0x0b6f36eb9bdc2a49,
+      0x9c11b758c627ac72, 0x7f96b0e0335b68c4, 0x6700e9f10c506edf, 0x2440208d8e97f3c9,
+    },
+    {
+      0x34de5a672948a3eb, 0xa4a6d50215efc93a, 0x64b59926cfd85141, 0x013304a05c80ff6d,
+      0xeacb54b0d1b22285, 0xf052d7f58d79ab77, 0x43bd31627fd77f37, 0x2a844f1cd9ffcaf4,
+      0x88fc59a74c5b5317, 0x1195a5a5eddc034b, 0x279ef38693fd490c, 0x19b80412c947bbe3,
+      0x5b9e6e83907b38ae, 0x4924abaa8a21c5f5, 0x497e12ce658dc74e, 0x240821cb0db17a62,
+    },
+    {
+      0xf25ec497e65bf995, 0x6c6bf32692f737a8, 0xfa41ab24d7039b6b, 0x09e0eca493fa870e,
+      0xa54c4c1c97db94dc, 0x14ce4d6689a3ede0, 0x035b7b22ac21b817, 0x287d6e638f389484,
+      0xb7d4e2b5d466d208, 0xd9846430108a360e, 0x19b270290e8284b7, 0x2f984196810dce15,
+      0x972fab5d49dfbd75, 0x1b20810198cf9072, 0x12bfb12f87757d44, 0x012f99688dd99886,
+    },
+    {
+      0xd3dd4c9f85c45c50, 0xaf6a6e0d1cc60761, 0xccad1dfbba7b1d64, 0x1ec9b19dc079253a,
+      0x69ffbfd627f96b92, 0x9520a4c33a1df0c3, 0x142a0e35f653344e, 0x22958f43176c0377,
+      0x992ff0d4c5428160, 0x328f5b6237fb2080, 0xe232baf648201e07, 0x0b66fdfb870d7c81,
+      0x016e2af1ec7c3c6d, 0x9595b43f09aba41f, 0xe8d08a977e1beb05, 0x20c5845d64bfb7be,
+    },
+    {
+      0x67d67dac888adc29, 0x7d70e38691e3f7bf, 0x499fa75852281133, 0x168f8ac0d456d0c1,
+      0x2700481069cb90f2, 0xe2e0d6d75b481e7b, 0xa649ad2f71e9bd5e, 0x193627b45aee1a1a,
+      0x148502c72b914850, 0xf5db4e8ca4527c6a, 0x50855b1ab7761c2a, 0x2e9b02117f760cf6,
+      0x7a07270338101b0c, 0xeaa6c3a830e5c4cd, 0xb97adf9d216364f3, 0x050fe8068f617e22,
+    },
+  },
+  {
+    {
+      0x4e707ec476fff2ab, 0x43f1da079744139d, 0xdc033c88ea96f3b5, 0x14a9afe6ce909bd2,
+      0x13ff17cb7788d91f, 0xda8aebf096d9c1b2, 0xfdca37f963f548d6, 0x28b8a9b728f21df8,
+      0x8c53d11bc8a9b285, 0xf4bdc5e760877b18, 0x120b70c8ea53cf88, 0x0f520317111db443,
+      0x2a012cf041b2c1f9, 0x5e05559eacc70c46, 0x2e8628b56381c527, 0x29675acbc512fc98,
+    },
+    {
+      0xce3163c765003540, 0x82b046485a683a57, 0x8d7de060a8be7820, 0x034ac0a842b03746,
+      0x5b2aff1ab5653d68, 0xe109d6f7e74e5a53, 0x5c6fb3c01a9b9b97, 0x30559ad5296d3fa8,
+      0x73e9b2dc68c209f4, 0x1d20f1da46f543dd, 0xc7742a350c1ad29f, 0x031c8e6957dfff36,
+      0x13d549acc989aea8, 0x59d2cbf75247e63d, 0xa992c00448eabfba, 0x2eca04a0939f8a2a,
+    },
+    {
+      0xd58ab0e085aa3c4d, 0xa3771e0e9af1cbee, 0x93074338bf56e769, 0x0c24201c17231615,
+      0x0255b7b72c826ea0, 0xed1c101c56f284a1, 0xb5e3cc11acbd2a18, 0x1336c47fa9390eda,
+      0x8376301fa3f878a0, 0xdee020c3c76475cd, 0x87006e4372d6c9b5, 0x05df871a728b13d6,
+      0xe2166d4283bb488e, 0xe82640d9546db476, 0xa8ad95033feee247, 0x07bf431fae6a7d56,
+    },
+    {
+      0x6e236dfcfff78e11, 0x12f04c2660899e0b, 0xba50badc588cd321, 0x0878924f8258ad27,
+      0x70e8958742188437, 0x053efcdc48b655ad, 0x526741cab47ab9b7, 0x28a71ae08941129d,
+      0x9e37e9ce62f304a6, 0x4931562aefb96337, 0x2ff8898c7db05c38, 0x2b7353088319da87,
+      0x9b653dc20210d55d, 0x4d98b44f15b27f6e, 0x568031bae587809e, 0x25f7dbe0ce2c8cbf,
+    },
+    {
+      0xac9b4be7411911d9, 0xccfd16ef8dd3f7ca, 0xbda723dd9e40e42d, 0x1a100762987aea75,
+      0x3db721379cc92ebd, 0xbcb2f540cb5b62a1, 0xdf9cb2ebca02aa2e, 0x0549e77e898f25e7,
+      0x8d6a27816dfe641d, 0x44478991a9037ee3, 0x31701bfc8b603338, 0x2e679484a8eb0c04,
+      0x9474692ad6eb4ac3, 0x67c7f50c8fb7cdb6, 0xdc27f6a715ed0a03, 0x128b5d1dd49e5e98,
+    },
+    {
+      0xf2279bf3893f90b5, 0xfdc9e5b306885926, 0x39bd0e803ba96fa4, 0x0d034e4362022721,
+      0x80af313287251595, 0xb66db5f3a58e1e6d, 0xbbb9d6ffad9a5ce1, 0x2ddfa715490ec80e,
+      0xb907aeb5576a2101, 0xe53c4bd227fb35f2, 0x18dbd3f377c347dd, 0x1f79ccaeb0331ad5,
+      0xa9ea6d422c8cbdcb, 0xe46b40bad69ad07d, 0xfec10041c4736e57, 0x0b6f6598c17d6989,
+    },
+    {
+      0x09a16ad5ded526c0, 0x036fffbf48a8cab5, 0x9b99dfd380c0a850, 0x023bdde4245a5151,
+      0x56e7b257fed97c69, 0x19866c9cc6f95b0d, 0xddfb935d96814eea, 0x15769d6cfc7b53cb,
+      0x7fdab8c5b8ceb235, 0x405e406cf8206379, 0xa57537f504a9d70a, 0x2ca31fd490b883ed,
+      0x9807ff0bf5343da8, 0xa1632e0c7ec28cfa, 0x7dd9cc73277a0aa4, 0x2f935ed27df3b0c9,
+    },
+    {
+      0x00b12e4b2b3f99af, 0x43b857348280db69, 0xdfbec69f9855860c, 0x0ec06ea2ef635886,
+      0x171c1197983c2706, 0x92113968b939aab4, 0x3bb53b72bc5aee06, 0x10b0dca9a5ddee5b,
+      0xce294ec5d4e94a30, 0xee682117a0aa76bc, 0xaa19b0fa79b3d29f, 0x2819b8eea3249a36,
+      0x73816b6430a318e4, 0xcdb2fe23bef5683c, 0xd5c88109687ea526, 0x02c9320fc8d101c9,
+    },
+  },
+  {
+    {
+      0x222265ebdf1b91f5, 0x6771161ab378fc0e, 0xa7173c76b9efc4bf, 0x1a427507ba322241,
+      0x0d5cfc46a970e36c, 0x15fcab27dffa0a9e, 0x7513c6a7dcc5922c, 0x09902539667c5b9a,
+      0x7184d3e8ca77d1ec, 0xff69d9d04e735fb4, 0x6147b37fce26369e, 0x2bf06bbba9eda425,
+      0xab805757f2a43469, 0xd0d6ac6d72bd65d7, 0xfabbb0d410dfdf0d, 0x064a1644bc4051dd,
+    },
+    {
+      0x09def2659f16539c, 0xa4bcac1c35b83e7d, 0x3e53461f6a4bf0d0, 0x114ecc1fc33e4aa1,
+      0xec30d5ff3ea16b5b, 0x2f9f8147cf6f8e6a, 0x721beb916ac045a3, 0x0b34e78544858939,
+      0x86bf219f50da943f, 0xd088ddc1847e9c04, 0xfb9bae9a0706bd63, 0x039e49a34469f6f9,
+      0x8db9d1b5b299c304, 0x5756320daa15e37d, 0x3759549375455a54, 0x0cae534a97f1be14,
+    },
+    {
+      0x7b0ae7cc0bdba2f9, 0x4437d6e623d2bca9, 0xb4128ae1dcfcab1a, 0x139bdb2cccba5a99,
+      0x0e67ec1f7e8fcc1d, 0xeb48dafaa1b29956, 0x9c83d849effaa3af, 0x2a965b748f9108a7,
+      0x3ef0347c904e9576, 0xcca0a05b13ed7a00, 0xe43ddbca8e705a96, 0x16658c07bfea288b,
+      0xc584e275054b8d95, 0x789f855f142e6789, 0x64991cee5cb1fbcf, 0x2eeaba10ed477bc2,
+    },
+    {
+      0xa77062881a3d2669, 0x8c960131777b350c, 0x024543bdb60447ab, 0x2119594c2eb06aef,
+      0x9cd9402a14e3f8c6, 0x609f24b336479913, 0xdc9df68ed67c6cf9, 0x15006a2771cabc13,
+      0xd554da5d8c206070, 0x6a48be0bff1e38ca, 0x68fbee157edb41de, 0x050c67e0d4c06a35,
+      0x887cb53041538692, 0xdbab28dd6130eaa5, 0x21195bd090e0a2cf, 0x208dd2820a1d3502,
+    },
+    {
+      0x97d17cfe13538253, 0x5f01926622859e60, 0x0428602353ad93f8, 0x14ff0f5596a641a0,
+      0x010fcd91070b2810, 0x0a8206ba2c1d67fb, 0x74f754fa3f82d5b4, 0x19756e3aff3b5f3c,
+      0x659473f8438259e4, 0xbdb7df70bf92fa2e, 0xfe03f0028300a9de, 0x273d403bff9dc88b,
+      0x9318295ccc4229c7, 0xd3fdd432a374134d, 0x92099c5c25cdc300, 0x2ab31709e58f1b59,
+    },
+    {
+      0xcdcbb4d1eceb1464, 0xc5862b35702667f3, 0x858050175642a72a, 0x17983f251aa9a626,
+      0x394e09c73bf3cded, 0xe05ad1f01fe2f077, 0xc5d454c333fd0b0e, 0x04459179efeedcbc,
+      0xc81dc46c88fe9e4e, 0x99077bff23a0087f, 0x3a6287a3504f2227, 0x15753be1d01b374e,
+      0x4b3fd237be188967, 0xde0bfd8118308884, 0x13b63ae0caaec890, 0x0109a12ec5cb376a,
+    },
+    {
+      0x7e24660e473f84f1, 0xb5f6997f59650b66, 0x5811f583527062ed, 0x2f242dd45ded2daf,
+      0x58ad359d6be86337, 0x569ec18c9ad8ef57, 0x54b0355882ab8018, 0x2bf682a0074a2633,
+      0x4a2f031f52085f19, 0x80056071373394e6, 0xdbdba45cae39f939, 0x059feadf662f1bd5,
+      0x69550fd75b1f84c1, 0x47f5b998cf7f3d4c, 0x73fc931a44378a17, 0x255329d7f2fb05ba,
+    },
+    {
+      0xd52a1cde9809e724, 0xe7278598edfbed92, 0x5feb5cc4ee1306d7, 0x202d1626195dd73a,
+      0x8159defcf6e836f0, 0x0da78d0875eaef61, 0x409009b07d5e905a, 0x2d2de938de741beb,
+      0x8300e82d0f2daa4e, 0x613b627650c41929, 0xb9b2b6121f19e484, 0x243533a3eefad2bf,
+      0x26027b63a012f063, 0x3ac6220357335ecf, 0x33e012880db882e6, 0x18760f8de155ced3,
+    },
+  },
+  {
+    {
+      0xc0de99c10a31bcb5, 0x2f9704a88a85a537, 0x9f3d3e9f1bcb5f53, 0x220af4649d37cdbe,
+      0x762a9c2b79c6f45b, 0xeeebecd11ecd57a5, 0xd6958ba17c0f3da0, 0x14e6f601fe3d7a54,
+      0xc3e0881cb11f0e01, 0x4337a2ed81ff31a7, 0x3fbd4c1b173de713, 0x1248d86e3146c717,
+      0xccdd251d37c2b20d, 0x01ebd425e89bae64, 0xb698a0c3ca3dcc02, 0x1590ff5a6c626405,
+    },
+    {
+      0xed0a2dae7ecc56fa, 0x6556721c76077123, 0x6f46958fe0be75fd, 0x18246dde06b79b50,
+      0x947363d2bde79637, 0x685fee4933898ba4, 0xdf4b8e67fdf39158, 0x1dd11e9435a34e3c,
+      0xd5936cdd4b6b29c3, 0x7fb7f6ac453ece2a, 0x04569946aade761e, 0x2f9f9fa0818c50c3,
+      0x8185a2b882a3be4f, 0x137393bc6f6e0ebf, 0x423a7b76134d4c9b, 0x1f7f2fcb826e04a0,
+    },
+    {
+      0x1f058370a4006aa9, 0x9755fa6cc8373df5, 0x581c6a475b4a4888, 0x027e26dafd6d170c,
+      0x496a97be8b301ce7, 0xd02d9be0126f6bbd, 0x98c323bb5da70c46, 0x1beb231d5e4aba6f,
+      0x4f8c26b8a0c58550, 0x66fb495b493a254b, 0xd9dda0ad91fa4b4e, 0x083ca5746a6f5975,
+      0xf5e1ffa4a67201ad, 0xe52f519f90c03e68, 0x3dac38a0dde22d3e, 0x16df8f1dbffddb25,
+    },
+    {
+      0x2a35125a2a670ba7, 0x3b70cd5b86e713b4, 0x76bbbe009e50f351, 0x20d02c20ee7f650d,
+      0x4f1d350eeed71445, 0xf3438518ed563af4, 0x0bccc8c0b8933fa8, 0x06d0ff67f217fb7a,
+      0xd0740e8640b8b06d, 0x9b6c20fa90869c2a, 0x9d2d7395e198cead, 0x249dae91583c7054,
+      0x0962a426d1c2f742, 0xd5bb193511b5f02e, 0x7a9197700dcc4f72, 0x187b7ca4fbc439ce,
+    },
+    {
+      0xdc2285c57584c5a6, 0xdbe14a6592b36aa7, 0x046f12584988309e, 0x1965d44d66f8a8a5,
+      0x46d412a377fa3276, 0x8f69ec7d2e3f6c38, 0x09a29589835d2639, 0x1e83a15d827022b2,
+      0x50ca97b4b91b1ffd, 0x031ecf753992e0a5, 0x7953368a1049ca13, 0x175f1e0ddcb50dba,
+      0xedb0962cddfb04eb, 0x737aa4579e5e0d36, 0x10c3e2cff11816a8, 0x04f60b6d4c18b9b7,
+    },
+    {
+      0x3346ed2b481437ff, 0xeb150c4297bd92c7, 0xea9455ac4f5577be, 0x21fb224b86335aef,
+      0x98e8afff68a9274f, 0x5d87ce3a7980440e, 0xf5d5d90cbf18c557, 0x088684d2f7be476e,
+      0xb09699e0a4b8dcfe, 0x9d7fdadce35db8d7, 0x1651d99421f2a632, 0x00c9cfed7ff8d0ec,
+      0x0c32289376afc5d2, 0x19c298f2ffd7b286, 0x5b25eabfd3228bf0, 0x28ab04070c3b0dbb,
+    },
+    {
+      0x45e05e1334b465f8, 0x03d29db126220b1e, 0x5736afbb9405ecee, 0x0c08aac307158782,
+      0xfcdeb3eb3fe1c3f9, 0xd66942aef8b14f7c, 0xf77691e71299e099, 0x20adea1c07c3ed68,
+      0x99db0798026513d7, 0x60df65954ba078ee, 0xbb4ce11b9b036fee, 0x2319dda286322811,
+      0x0e00a21e555a1268, 0xcfa299551c0d8100, 0x43ba6daa2ede9619, 0x1bda65bb279be967,
+    },
+    {
+      0xf4da65a7383a5e9e, 0x4e23f09696f4f1ae, 0x7f59a4b175b04ca7, 0x12f18b0b32037f3c,
+      0x34050e96299baaa1, 0xc3acbab1ac9b3eed, 0x4fc8f19f37d2520f, 0x302b7eb3fb6cecb6,
+      0x60bb12277faefe2e, 0x53bb3f04e510702d, 0xb2f6edadfe02a496, 0x2fce68771bfe7da0,
+      0xd3f1f9bfb9ed2df6, 0x2645d7916d505868, 0xcb96476ea61db689, 0x2902095929a2b2f0,
+    },
+  },
+  {
+    {
+      0xd8bb91a6b2ff389d, 0xf1b17df1a3daefbc, 0x5ff61873563be996, 0x300b01fde70a8d44,
+      0x8f95f451fd5d195f, 0x2cc484e83b889a0a, 0xf336c2af1414bef5, 0x2f93e1b17381e727,
+      0xb6afe5796be462b6, 0xb0cc7212f3be8433, 0xba181044d9177f88, 0x1ae43a0d1944e78f,
+      0x4bb4f49df11125a9, 0x2651e33cefd3182e, 0x38d444e3c11e65de, 0x0e980e2e7abdc7d7,
+    },
+    {
+      0x117d83a1ff462d1a, 0xc1f1694c505778a4, 0xb5483a29f7d0eb93, 0x1e4092f6824a981d,
+      0x9f290caed980baf3, 0xd96f63159b2ed67a, 0xc3ac0ab1f0b63997, 0x12d83a45020f5062,
+      0xbaec491165fa6ba6, 0x6759b3526c2a7892, 0x580507e7ee304400, 0x204b5c30cdad45bc,
+      0x8bf779683e2c544e, 0xf28b14e04c356bb5, 0x70f5738a055188c3, 0x20107bf5c8c0f89c,
+    },
+    {
+      0x84956257a027937d, 0x4aa89ada26765c01, 0x4609465b4e264168, 0x21d270ecc108dbbd,
+      0x6902b6307654d9f5, 0x4e1aaa8b773052ab, 0x8f28c18ef51a47f6, 0x10a521778ce83dcc,
+      0x8dc1e68a37733ca5, 0x796238113ac1e58d, 0x26226c1c1894734e, 0x2a9a84d98b3eeb12,
+      0xdd4798c218e59d19, 0x08bc8804be80f03c, 0x27f8f173f17ca26c, 0x269cb2493ec6014d,
+    },
+    {
+      0x9553d51f54263960, 0xa476bd49b6bc05d5, 0x7733468883486788, 0x1e02ba8a79c8d4ac,
+      0x5c712af69c23afdc, 0xd4f5880a334b9a7b, 0xd6a0b57035f656cc, 0x190c20cc962a81d0,
+      0x111a2713b9e92e55, 0x85a2a8c0655a18f4, 0x283625a2971aaa27, 0x1e4cf906f9f362e8,
+      0xbbdd84f225444109, 0xb13d7021a33142ac, 0x06f401241d310841, 0x1212b7a41e1545e4,
+    },
+    {
+      0xa44b03a0b750582e, 0x8ceee28171ac5ff6, 0xa90dba1fe519c3de, 0x0cffb6cc55b86199,
+      0x8adf64d23ec09007, 0x83cd1f9e88fdb184, 0xa5dfa3d81a5d3086, 0x01befbf7eecaa92d,
+      0x6a96ce266917a95a, 0x7e7fe607ffacb854, 0x9073136f7a6d7773, 0x27e022bca95a2e94,
+      0xcc6790261035cd7e, 0x72b6ba8b6f397726, 0x8657caecfdf5447f, 0x0642c1802c1b3ab7,
+    },
+    {
+      0xb9188ff7f1e77623, 0xf329a89ca54e860e, 0x79516e874c55c8a3, 0x09e4f4a718661e0d,
+      0x7120f3bf5c891c1e, 0xfd5810e316d8249f, 0x51331572fe1aaba1, 0x1b5ae13d9e4deb21,
+      0x4b4d599d780ab0f8, 0x45ed968656b8301d, 0x8b04631181d27b03, 0x28208e948d6bc12e,
+      0x19e8cb06ab11ce18, 0x0988c3e2a0a720b5, 0xa1d9375dc753b6dd, 0x0e66a181b79b64a1,
+    },
+    {
+      0xedafe35cb2a9f014, 0x9940cfbf69908b21, 0x8122c21c05c7d123, 0x1db8ba43a936a3d1,
+      0x44534d6d36032d99, 0x7e56d870695b6c9c, 0x0e2019caff985f29, 0x0f40f55721397420,
+      0xe7ed4e74ea2a64e3, 0xae22546c149ad881, 0x499e5df5940fd6a3, 0x278de44272b07679,
+      0x238e3aeb343731f2, 0x1c3feb4e0b2ffd30, 0xbcd2728e193cf903, 0x0724079f7693afc5,
+    },
+    {
+      0x0ca1bf82aaab68b8, 0x4fb03f7dc8d9c4ba, 0x9a5451b784be7da1, 0x068f68fbb0a7cdcc,
+      0x6076831f433aaa95, 0x8e9eac30bd5ce2be, 0xe7dd00e0d3bcf401, 0x1513728dacb30ead,
+      0x51c4f86bb34cb719, 0x79c349ec309e27b5, 0x775a972d34a31317, 0x1815dba7ded2913a,
+      0x0dc4fcfabee8c4ed, 0x7666cc4ac744a99c, 0x1e0abd686ef945e5, 0x05a02df9e364f431,
+    },
+  },
+  {
+    {
+      0xef23b57fda6d6bbb, 0xbf9807915d19023c, 0x781532c2f6eec11d, 0x1e80e3eea23db7cb,
+      0xda626f034e8df26a, 0xa31fa03861daedb8, 0x2d0ad2b3ca999398, 0x084eeabb1423aa44,
+      0x772b7ca0bd82c1ba, 0xa4dd2c8032452e55, 0xb7b42d6b23a126e0, 0x044247d9cf68518c,
+      0x4244fac3eecd189b, 0x5ad49851d3058478, 0x12b9fc5f2efdef80, 0x2962570cc0df4ad5,
+    },
+    {
+      0xb901bf0a6ad505d9, 0x37d09ca34ffff77d, 0xc9732a552eac90eb, 0x23f9bdfed121d8c3,
+      0x0851d3b91e34f4c0, 0xc2f6d5ab3925183a, 0xb3d4f66fd1bf4311, 0x1e6831f886a4b690,
+      0xb8a443332c86d603, 0xb596a4568aebe0db, 0xa6170bc8fa561b33, 0x2d4c36579089f4f8,
+      0x7a86c2fc21a7d8d5, 0x96aad1360c672055, 0xa0ae9511e6707e95, 0x2a1685d8fb3c2e9d,
+    },
+    {
+      0x59a86be3f660c145, 0xa7fbefcc5ba5c102, 0xd906c7481473031a, 0x10efe28ac6790b36,
+      0xfe83bdd265a3ee2e, 0x50b3a312ea33de7b, 0x8526ceca5a4b3fdb, 0x1c5d37091be89801,
+      0x4b0e859d90645b83, 0x3d5c05c71223697d, 0xeca20d83491b9439, 0x2321670a87bdc134,
+      0x712b47d9b726a3fe, 0xcdc830514df38ba5, 0xe5bdb4670ac56387, 0x240566370c23c662,
+    },
+    {
+      0x9089a1b32ad4f781, 0x861eeb0e640a155d, 0xeac0a609ed127b30, 0x0f33f562d72535af,
+      0x0efb57b9f8440860, 0x0d26752f1293fb3f, 0xf1569ef02953e1d8, 0x2eb496b653fa8180,
+      0x5868eb637b82df8d, 0x4f5ba0a66ba4a312, 0xc441c2fcfd768037, 0x0e7d72a82f5fb35a,
+      0x1ea2d6358d1da4d3, 0x98d8c9e8dcdbdd5f, 0x9d1685cca27386cc, 0x1cd53113561fc7fa,
+    },
+    {
+      0x59d2602961b783ef, 0x31bb017018f291cb, 0x166c6d2978d1744d, 0x2ebb04307cd6d300,
+      0x214bc9c4086eb37b, 0x2b1c0c1d48309868, 0x2391fb9782e466da, 0x2518b7fc1c0ae40b,
+      0x43f11564ca5a15f3, 0x7fd742a64dcd46a8, 0x6651ca9732964742, 0x17597e1ab5185c78,
+      0x3d932651b1da93d7, 0xaa634a44c74a60e3, 0x76a7449aeaa84abc, 0x2d62b248dcf43d4a,
+    },
+    {
+      0xeaf323bdab20c3c3, 0xf1e69baef77f86b5, 0xc870ba4711400763, 0x1d509ec623c009a8,
+      0x8efde94b16ac8fae, 0x40ff3e454d88d19b, 0xd7f7810db541cc61, 0x23718c944b81dd4c,
+      0x2ba6da31a4843eec, 0x5faf3a0d7204b07f, 0xc27210da8ce81a1b, 0x2afce1500442f7ac,
+      0x5c63ba4effb6fcda, 0x1355ae30c751961e, 0xf4e3184f78e06a0c, 0x23023e9784939427,
+    },
+    {
+      0xcaf05105b3d8d053, 0x408e47113d8b2444, 0xa1c367ad2f367a12, 0x1ce2c654078b33c7,
+      0x1aab001200587db9, 0x3268e2273e9c1e06, 0x5aaf683324b6ba1a, 0x1cf5b921baf5a4de,
+      0xe45173b36cad19e3, 0xb265ea7487dc5489, 0x87fce2bc063fe1bb, 0x181730ed2e6e4340,
+      0x50a9737d885de575, 0x9b2084b5b1c5b22d, 0xda2301266cbc9f9e, 0x2db7a5fff7f8d589,
+    },
+    {
+      0xdcca7c0c620b4e67, 0xb31c3c84c97cc1fd, 0xfdd61c820f5c0c57, 0x249009a2c848249b,
+      0xa005006e42f972e3, 0x35156aecb697c7e8, 0x39ce2b35b3c68c13, 0x24fd70898fa6277c,
+      0xc52860f9b88a3c28, 0x0d7e8e1faec1bd0c, 0xf1f162a71aff9b4c, 0x0a7cd44f194a6fad,
+      0x292612ade3bc5997, 0x91444e1181d7a921, 0x54b0dad2f5103031, 0x173f40a97019514c,
+    },
+  },
+  {
+    {
+      0xd689684b560662ed, 0x2852efc982afc15c, 0x502e81f56a99ba63, 0x2a56dcba8c0fdfb7,
+      0xe5a3b422c675bfa0, 0xa237c5c8d18ada77, 0x6fdb9b46307f3a16, 0x20836dc76017b505,
+      0xdbe2f9bb261ab24a, 0x465af78fdc2679ab, 0x0989b8094d86a667, 0x2a7a7e6523cf775d,
+      0x8d92095ddce0ed09, 0x03ea8ef5b1e773ac, 0xe58a06241c454fac, 0x0a2e01c1db557dc6,
+    },
+    {
+      0x63f7c72e6ef26933, 0x4f499499edd52ccb, 0x2a7b6302281c19ec, 0x1eb3622cf0550d45,
+      0xd668ecaa1790dcad, 0xfe05b301156fa72f, 0x1063e401b3720285, 0x0821077cf30f7dc7,
+      0xeec0e11b3c09142d, 0x57268ba63e115349, 0x41db6b54d2c87478, 0x22b758644bd38cd0,
+      0x0e295c9843ae47d2, 0xeb3241f387f81ea1, 0xfa5c10a0acf700f6, 0x047ec536e05af39c,
+    },
+    {
+      0x8648b7b83b677f78, 0xd94dbd9485d8f6be, 0x54b44e32ba2c50e2, 0x2ae5b4c49d9b4b34,
+      0x0c2674107f1914f5, 0xea1e72086c12951d, 0xc61b6b1c6ed726f6, 0x102fc97c4633dacf,
+      0x209b044549df898c, 0x66c0b8b42dfd6a78, 0x1d86e132c28a9f60, 0x1e2721e64a5d6bbc,
+      0xc881b56d17cdd63b, 0xc8e6dd6b5269dea3, 0xac1866c26cf109df, 0x15ed00dc7f7469bb,
+    },
+    {
+      0xafe1178be3dfaa06, 0xb4a1da13c240d51d, 0x030aade7743facf5, 0x092fbefecebd0536,
+      0x131ac68f8a498ee4, 0xdbd61fcfd1e9582b, 0xb48b8cb551feb52f, 0x102c9a63eee41930,
+      0x05e490bd5cb2db08, 0xc6e3db9dc0fabc31, 0xd172e77788845a40, 0x0581ab152e621d01,
+      0xc9e719f4062f455d, 0xdcbeb7ebb75d762f, 0x01d0d0fd7e53ff6b, 0x2ff5a8e6e1f00c63,
+    },
+    {
+      0x2024b8f324a53357, 0x464582feb5d3aed0, 0x74736141301d833f, 0x1e5e8a0e9f9c1aab,
+      0x762277b1f12c51fa, 0xca9e11565e9c6f49, 0xf9d5bbd182e0bdba, 0x0fa79a5aecb567ec,
+      0xa3c78f6bf21e394d, 0x8d89c69da0a8fae1, 0x4d92675bcba5d103, 0x12ea2f97aa72fec0,
+      0x32744170faecc946, 0x22e00b3266d5c3f6, 0xbdfea1fff22607cf, 0x2d3a44f72769ffbd,
+    },
+    {
+      0xc077309dbe2be8e6, 0xb0ed9adfa0ddf111, 0xc6cd9bd58fe04ed9, 0x2b0bcf3d629a6ed9,
+      0x64131a16c419d907, 0x0aab6ec7a51a6c08, 0xc523e31948780444, 0x254a9eccfd652a70,
+      0x74f3d974033e0ad0, 0x14755a167ea8538b, 0xa569366f21cefd75, 0x288dd7a1b0e2d808,
+      0xd2a9a23f754b6e75, 0xb4c04d8ffc975042, 0x239f81fc99dc6bbe, 0x231cfc894c4b0c3d,
+    },
+    {
+      0xa4630f40e027d1c7, 0x26f927cb8d003049, 0x04e3485adf6265bc, 0x12e487c7f9c46ddd,
+      0x0c3b6c536c0fcefb, 0xa7b2b9f22e80fd7a, 0xf6fbd472224beaca, 0x10b1e724b861ef3f,
+      0xbdbe403a7dd0a127, 0x6cd8f265ad2a82c5, 0x932010c4a99803ef, 0x165130bc1c1e7d64,
+      0x0ae38546053e8c81, 0x864461b0a0d6f79e, 0x5d4f13c9459e5947, 0x2caeb9c3a2d8a902,
+    },
+    {
+      0xd616d83db607e70a, 0x1119a8f3adab21a5, 0x25ad46c19ceb577a, 0x1f6add5ec101fad2,
+      0x564be9e178bb20ab, 0xba9769fd078f7a67, 0xcc0b50f1794ac462, 0x1dbc34f684dea99b,
+      0x3e838ca4c726cb3d, 0x1cd733bfe56940e0, 0xef7c29893391e426, 0x0eca358d737cbcfc,
+      0x8b98afef1338f7a7, 0xb3609778624c1c0e, 0x4f2d2736e41cff3a, 0x07253ed30e85e026,
+    },
+  },
+  {
+    {
+      0x0526f643b3a67669, 0x69e7184cff1685eb, 0x73b1afd58cd9b340, 0x1a63587e1f4c80b9,
+      0x54672b11f03fa191, 0x19d1ba9e155a1195, 0x8313f629446a0eec, 0x2563a7a5052d2a20,
+      0x62874c6a1d126e6f, 0x8ad3a9ade2f858f5, 0x8b1dff3b5e072add, 0x1b99f14337413023,
+      0x305e14b2d6a39497, 0x940cf0796bae6410, 0xb853977c3a1d6439, 0x20dfef94c0cb04a1,
+    },
+    {
+      0x0600b63f61e96b7d, 0x7bcdc815317bbfa6, 0x1a02d8cc377ccdf0, 0x1a7b6b66e6b9c934,
+      0x264e2299bc96fa12, 0x93a60d538094f2a7, 0x3c044ac588add639, 0x256e0f80521bc7cf,
+      0xa0614ad9821c0236, 0x028742525ea8e5a6, 0x01245e40fa607510, 0x2063dac421aef488,
+      0x0f4cb7ccc625a402, 0x8ef11aee5a73afbc, 0xe15397e9d3cd09a1, 0x1c1793c5695a6e0a,
+    },
+    {
+      0xbcd06eff2fdb13c9, 0x2ecb18ee878fe5dd, 0x160ade7035a9f5b4, 0x01d10638ebcb2328,
+      0xa7dd836fc7e5fc27, 0xcf438b36efe5f6f1, 0x17776560fa77dea0, 0x2b57c15b85e9fe6d,
+      0x08ed77f674c6dd31, 0x7b4b7e01a4865a65, 0xcc59251b0bb005ad, 0x1865c8588e9b1549,
+      0x47a5c3be956d2f19, 0x100f8027fb0f9e5c, 0x83cd4671621d505a, 0x0be493cc698fb1db,
+    },
+    {
+      0x1947d745962cbce3, 0xf9584e5f9325e8df, 0x89dbb87bbf342d47, 0x119865fafbc5fe89,
+      0xfdcf983a604890b5, 0x5badef71bf03591f, 0x17e00848817996d9, 0x04043d0176ad5505,
+      0xdf72ef1ff24414d6, 0x77aa7b8735829673, 0xe9261930d8221939, 0x009c48d8ae2d4b0f,
+      0xea0338b04d0711cd, 0x214467df67bf6623, 0xb101f3ba4a7281e5, 0x0461e5a4e634ac86,
+    },
+    {
+      0x7e3dbeb1736ef899, 0x811d25a630e4cf3e, 0xc2d11157833b3048, 0x1d543315953d47ed,
+      0x6f5ce1932d80743e, 0x90eb02b495009569, 0xc1714e050d0c0754, 0x152033497fcb5ec6,
+      0x7aab7d0a6b75ff29, 0x947f2cfcd1028f0e, 0x620d47ccbd523464, 0x03ee891cdc2f338d,
+      0x4c05bb8e874c7c98, 0x8f80c801b1df3111, 0x5388e2ebdb8fb712, 0x0a01f40a8ac97c55,
+    },
+    {
+      0x24d0fd836190f73a, 0x8d7de9a7d1790f44, 0xeb5e2fa5b17bd009, 0x1ee524698ac102d5,
+      0x050987358547d81e, 0x0cd316874380a289, 0x00b34876e58a8fce, 0x0e83844dc42b51f5,
+      0xda0adfd47d26f9e2, 0xd7432e38020693b0, 0x6f29340f3a4ea646, 0x09843a4576906fa3,
+      0x1ca35b0282bccbd8, 0xff6031667b400df1, 0xbaa78ccf7d78e3dc, 0x03a904b8686545fd,
+    },
+    {
+      0x09ec78484b9e853d, 0x05d68edebc178f37, 0xfda1151062b07db5, 0x241988a94d2047a7,
+      0x0237aa77ebfc4215, 0xf7d7fa12212998e1, 0x338cbf7c7f5fb38c, 0x22de674a99eaf4c4,
+      0xa7c141e3efb4a070, 0xba5ba34ef7b0b809, 0xc6616889809d4687, 0x18d7201997b900e5,
+      0x162164eaa68c44b4, 0x4ff98732758b64e1, 0x06d7c560cba14c0e, 0x2a81ef72a521bd29,
+    },
+    {
+      0x70a506a06fd5123a, 0xb733e89a8869acf6, 0x3f2fc14c786dfaf2, 0x161d1c153590929d,
+      0x94d94103b3f0f6ad, 0x3a8e035443343f79, 0x0dd5eac26cee3220, 0x149409688d161716,
+      0x2dfffd8d66f55a76, 0x5c773e889f156f26, 0x40fa284a7756ab77, 0x063e1d5197d15bcd,
+      0x04cfcc7051f48efd, 0x4c9a8d0e09bc76ad, 0xbc5ae01568e55aaf, 0x2eb5f76b1a51294d,
+    },
+  },
+  {
+    {
+      0xf53de58d268a942e, 0x8f00009494001c99, 0xe4354bd735175b36, 0x0c017cabcf6921ce,
+      0x2795fd9be94194d1, 0xb8b4a0eefa701ee0, 0xbe311d51a5761cd3, 0x2afe40683f642d24,
+      0x96169fa8ae685493, 0xf096d5f910591c9a, 0x8a05b23280ad19d4, 0x1aa97460674a2014,
+      0x2ee8fee5e2e7355d, 0x05673c1e4ed9d0db, 0x234fb884a41f9c85, 0x1fb7e438bc7e739f,
+    },
+    {
+      0xa24df23b20b1f0be, 0x76cecb00cac7f454, 0x6e6e7308cab5eae8, 0x26cb9952f67eaed8,
+      0x0f93845cd5ef184d, 0x59ce15c5333c6f46, 0xdfa2a0c585cf0a0c, 0x0915dcfc56056904,
+      0x55ae0ecc3799c178, 0xb19d69448268544e, 0xb54ca6c6f9b10101, 0x00166891877c6e99,
+      0x29c7bac1ab433633, 0x7d4a07e3a6350f67, 0x34c71570b405e57e, 0x12eed38b3164d63c,
+    },
+    {
+      0xda0acdfeb4e4dd27, 0x43420e7c465e1954, 0x79d1370de2c466a6, 0x1236ba0dfeae149c,
+      0x37470c9f57b5b1e3, 0x76e1dbd8d76ff603, 0x56cac9437dec8c53, 0x0c06a0a1e3eb15f5,
+      0x7cdfed823584b101, 0x41f6d9703b6c271b, 0x14d6a95b37ee2c30, 0x1ef05a352a196561,
+      0x2eeca258ceeebe97, 0x5e191ced0f80a3a7, 0x8ec081e7a40a0670, 0x2f1b25135ca0f75e,
+    },
+    {
+      0xcbab794661de16a6, 0x956151e07e38a796, 0xc1b6737b53385e3a, 0x099586de200f503b,
+      0x4a40cd3ddc9b2bb1, 0x0f166209c4e1158d, 0x272f53a36f137b96, 0x0e3bd8cb19efe729,
+      0x1859e478b6761179, 0x1f395908759f1ed2, 0xf113b8733acd4de8, 0x102c2de91f08b742,
+      0x7efe4e4a3f01822f, 0xb1e2bd56addd8f95, 0x0a08706c984d6769, 0x2316b9c39f427c0d,
+    },
+    {
+      0x6df04fdaf42deb7f, 0x2556c9210010e82e, 0x9462c6077106e1b4, 0x183cc2d1ac7d7f56,
+      0xc2c6c5e002a058c9, 0xdce9970af9ceaeb6, 0xdec604e22d6ff50b, 0x135a0c175adf0fa7,
+      0xb975605de4474296, 0x65ddd6eecfcbd7c8, 0x9004f3341761892a, 0x1e958414a42a4ccd,
+      0x15881211828c18a4, 0x6199b5df5a05ed75, 0x35cb03cd496a9cd9, 0x242a32d9b7480e7b,
+    },
+    {
+      0x1ce66fa0058123aa, 0xa46c7e34c5024f24, 0x71caff103cf52983, 0x2de9b0a03048a2ef,
+      0xbb5d84d04cfc28da, 0x73b20262b5bb1f3f, 0x6c3e84e25671b36e, 0x01ec737dd07be926,
+      0x0aca9718bfa7266e, 0xf3778d0497929fca, 0xa66062930e6a994f, 0x014d8625724850ec,
+      0xe5ef9afd9671e012, 0xa1389350960e72af, 0x46126bdef46ab83e, 0x09fe85be91672330,
+    },
+    {
+      0xbb061f4493f9fe2c, 0x84b04d1029a8a224, 0xdc4108d55a6595aa, 0x0d4f7f8cf673c9fc,
+      0x922e3b8a09f8818d, 0x4ec7b32190bc64c8, 0xc55718de94940a95, 0x031259937c3d5d31,
+      0x74799fc0318e881e, 0xcd10f1349df7fed1, 0x5b40484fee229607, 0x23d1d2ff8899e2d3,
+      0x0b522f58653fdd29, 0x719c68f47f13b3e7, 0x01bc3ac8a64811cb, 0x2b5b5d37c2175281,
+    },
+    {
+      0x90fc30d17966f0c6, 0xd49db9b24974c4d2, 0xf8dee5a563baaa61, 0x1e914108bd1ca34e,
+      0x0a0f34e8b609cbee, 0x3ce591bd647f0602, 0x2b0151c71234d467, 0x29d94803b940b9a3,
+      0x369b3b4ccb426f17, 0x0e3c4aac4f8ef14e, 0x678f9242edb4c8fa, 0x2ac17bad8ba3c192,
+      0xaff518089ebe30bb, 0x707b861947eadfff, 0x2340aba449dd37da, 0x2179c33316fe2971,
+    },
+  },
+  {
+    {
+      0xb61797268751d4de, 0xc0a2f93ed8f3e8f7, 0x5d6a13d7593a503a, 0x08b6f5aa78da7402,
+      0x001ac2f6c2bb1102, 0xe7600c23323ec364, 0x533c583201c4fa54, 0x0a3685b60efc210c,
+      0x593a24420c7d1408, 0x307907e7fb87659c, 0x783f72fe5d75b05a, 0x0a9e298049082300,
+      0xf3235af16eb71df1, 0x7fd93d06627d1fa0, 0xf17a2878d4df03c0, 0x1c1e56dca461825d,
+    },
+    {
+      0x4e0b8402f4e87109, 0xc5cd6869dfc3b970, 0x290171238b784442, 0x093f28a20c741e73,
+      0x2f881ea6a0ee26f0, 0x53fd3798214bbdab, 0x168a91404f08845a, 0x11bd8d17688b5610,
+      0x9e9fab432a82eeb7, 0x14cbe2f4ede24fed, 0xa4013e81dba7e65e, 0x2af2a82a08c6e7fa,
+      0x27697de360cdd6d4, 0x54c70ef41d37a33d, 0x323215ba9dae2228, 0x070497962aebe784,
+    },
+    {
+      0x3b028760a9f73c0c, 0xe6a41b9241ecbb9c, 0xb45111557321f1c9, 0x18a85346d3279121,
+      0xe156869d03b4ad7b, 0x63a5f449eb445350, 0x4d8ce11301bfaf0d, 0x0977041088ff81bb,
+      0x600940ccec050088, 0xd53e1cb754d386fa, 0xb1845afb401cca8e, 0x057206bf64225c8d,
+      0x7c6a10564daa6cd9, 0xde7b477a950b5b3e, 0x5bd7a4471ed0f0d9, 0x0d033d82008e3301,
+    },
+    {
+      0x2386b3f47deecace, 0xf5f8eff230e67129, 0x8059fe0f990b8d5f, 0x28f6d9dc7472fabb,
+      0x7c05a21044da6029, 0x2b2c952a11da48aa, 0x22170e80aa835203, 0x067c92f852b7d848,
+      0xddabacd8919e162e, 0x8bcd0deab808fbfd, 0x7001f10cf2ad03ff, 0x0d1cc6ca82c70ed4,
+      0x8798480a140f765f, 0x1bb417709ecba1a2, 0xbfede3847f454cc6, 0x241b837f0ecbeaa7,
+    },
+    {
+      0xbfe12f678d670c76, 0x8bb36475707dc0f6, 0xd21e634e069ae5ff, 0x160cf10195ac71ac,
+      0xf0672da5211b63de, 0x7760cea219b61b96, 0x69e6a11be20893bb, 0x1f4b45c72c05baa9,
+      0x6c679d07eacd37e5, 0x63cf04350c5069a7, 0x045bcdd2b0e18d75, 0x27fc074c87fcc635,
+      0xb2919d6fe70542c7, 0x23a59f198fe59062, 0xe2280a7944c65d44, 0x24a6768d188d89b8,
+    },
+    {
+      0x99f98b5e0c79b699, 0x639489e5260feeb6, 0xb10c120fb702ffac, 0x01bd76c35e4fe3ae,
+      0xd2099cf2028ba3e5, 0xa9c423768b7bd220, 0x6125aed9412f0fbf, 0x15576b66d29d945e,
+      0x1e589387a71b530d, 0x340370522961c3bb, 0x947dc64ab31c16eb, 0x11a21072a426f950,
+      0x18ab6c56efd96357, 0xfeb09f00abc02fe3, 0x90a58c55382bf445, 0x2629cb4151701f9b,
+    },
+    {
+      0x0000cab769cab9fe, 0x681c2c9a071114ac, 0x7e76a823b9974773, 0x1b9ff0787f115aa6,
+      0x2ff63599184cadf5, 0xa403d38ef2c15e7d, 0xb34bc3a0dfb2432c, 0x074f104938164c3d,
+      0x36d34eece377ac30, 0xae48c4d4f7ccc6ae, 0x2bfb962f28a34bf3, 0x061d569712ef7021,
+      0x3d969e29c8d14b46, 0x78d777046e3de894, 0xf2893f529672bf5b, 0x067543d4c6003ed6,
+    },
+    {
+      0xa1193508e966e57e, 0x3e17417a34cad508, 0xd0a22c39aa42f76d, 0x109766e3b9d7fbf0,
+      0x445a89e785747819, 0xca54d05e671e272f, 0x1c4dcf5c6ee86ba0, 0x1753dc02953690c5,
+      0xda410a7e8c3795f4, 0xcc45517ea4447e89, 0x1e119214e9f5b6f1, 0x1ad2e3782e9e764a,
+      0x92a050a8e89a74ad, 0x53d2fdd0cdf879af, 0x5eed20ec007d46d0, 0x1f579b9d5acebc69,
+    },
+  },
+  {
+    {
+      0x4cc7f566b0b6dac7, 0xc562ad661dddd5ab, 0x8e46d3a4d2ff04f6, 0x08f0ed44990e0853,
+      0xdf0083665feb64a4, 0xaf38d43f99440fc4, 0xb1eab8bb2578b97a, 0x2efd40e29bc6c76c,
+      0xd2986082e0bb2e75, 0x7e47ffd4e9421aa5, 0x437a560b69eb4aa6, 0x007c163fcf39cad1,
+      0x34ec715b4816e7e1, 0x6eb2c3ea245f87ad, 0xb9600473460c1ed7, 0x1d2302e364523f2f,
+    },
+    {
+      0xa5ff27d0bdba76d8, 0x6d5d8303cbee77f0, 0x8e05a684b71dd0a9, 0x297ad6026c323705,
+      0x42c1ca3d4cda13b0, 0xe26fc1185d4b93c5, 0x2e3e01275f256cf5, 0x0574ea099a2009a9,
+      0x535dafe2c664b7c4, 0x56d42e99f21e4d70, 0xa724d57501367905, 0x07214db89fd7e5af,
+      0xc127fe79949b196f, 0x7032ad0ccdccf259, 0x93d87703029eb739, 0x0def401dacbc6166,
+    },
+    {
+      0x48339510c9e90f36, 0x1ef5f53a8e53a4e7, 0xac6c8701847f1bd1, 0x22cc92dbdaa5061e,
+      0x5132b177093ed891, 0x96a2a8c358000cb0, 0x3f97902e803e8a48, 0x2ef84548813f3d06,
+      0x050fb36b92da8530, 0xbfde789ae8cf18df, 0xea5ed62b9e47d69a, 0x2e60740c1046317c,
+      0x51fb45eae37ce588, 0xf81c61d6252780be, 0xbb7c6dc6f7957561, 0x2c819f8bc87114ca,
+    },
+    {
+      0xc7d06d25276dbf9c, 0x6c64d4f7fc5569dd, 0x3bbdb644cfed0c85, 0x0b0fc18eccd4af04,
+      0x5717c98f00bc6d52, 0x9a64e11b77670f71, 0x1abfedb9e3effd7f, 0x064fccfe7807bdba,
+      0xf43a8d7cd1ce4c4c, 0x8eeaa1e7a98d5a64, 0x3afa05a36e3b1214, 0x07e1f993239d8919,
+      0x8dd5c590dc45966f, 0x06cfda820dde3730, 0x3d36d2e74c96a76b, 0x1142c982ef344658,
+    },
+    {
+      0x0ae395820e0d4b01, 0xca26396f1bbd7194, 0xa4ab1d34994c3ab4, 0x122c19cd78e54d8e,
+      0x4b5068b6b543fdf8, 0x8abf1cbfd73548e8, 0x9899aad69b07f6f8, 0x061ad6cb5a919f90,
+      0xe155d5ee50cf8653, 0xe58e0405ace82da7, 0xd397a890a4b91e69, 0x02926a4612b57c45,
+      0x5cabdcdf5a87618b, 0xfbdb5cc796310110, 0xa41293de4b7ab87b, 0x12b1f74e6057c7d4,
+    },
+    {
+      0x31c450054e64ad12, 0x0d1922fe007d56c9, 0xe462e636f7856893, 0x14b474787bc50a24,
+      0x1d2443d54ed8d332, 0xa71c1164a78752d4, 0x4a6037a5d1e167b2, 0x15e63e468e466648,
+      0x768796518aaa846e, 0x810283fccb62f0b7, 0xcd7f0687d83c31b7, 0x0217dc6c51f80b20,
+      0x093b8bf720d951f8, 0x34963b65d99f31d5, 0xf65f464b7dbe5e69, 0x24c9fea301a492be,
+    },
+    {
+      0x9ab2f0902d6a7ffe, 0x57ad0fec1e7b035e, 0x5c98a226455a2641, 0x0d8fa4afaaa2a4c4,
+      0xef1eba3863386296, 0x4ee7ee9206f66a50, 0x05d2a9b1dd711d6f, 0x13967b1a43f2d0f1,
+      0x878517419673b39c, 0x342c1127404df40b, 0x0a4cdb0877bca205, 0x08254f4db9a5a43f,
+      0xb594cc111ea3ae04, 0x311dcd624b64e154, 0x7769bcb5a74edcab, 0x29f5c01901953a55,
+    },
+    {
+      0xbdadce2942aa97b4, 0x79c091ec07f55b87, 0x46db0637031a2438, 0x0d77ced93490549c,
+      0xa1798202ad117b05, 0x7cdd81a243b81965, 0xe30b66c2c7178ef6, 0x2c2a1e816d05f39c,
+      0x453a4f49b2e48801, 0xee96a208e7737994, 0xdbf7621615da7828, 0x175c5a6fa8c1fa5a,
+      0x25acf428d8fb1e46, 0x7b71d1aec9deec11, 0xe3185f21936e6ccb, 0x1e55dda0f2b02d54,
+    },
+  },
+  {
+    {
+      0x95be450176b835c5, 0x492697f85eba90a6, 0xb4a6fd797756bcba, 0x2b8d685869d92baa,
+      0x3a67415de2f1f592, 0x802aa0663954cb24, 0x363745ad0c2be638, 0x08e86ba64f353aa3,
+      0x4c8baff36debbcf0, 0x1e6cdb4ec070ab5f, 0x7d52fa4444927a44, 0x25a19113b0d51215,
+      0xdcd1e3899d2ee06a, 0x112e8696f921c895, 0x03d56140882321e7, 0x300f1989e2937ed8,
+    },
+    {
+      0x5603b1687f2a3d91, 0xfec81b195aa5cdab, 0xd314367033ddd50e, 0x0ea5c2a4ed11f323,
+      0x162d78efd9fb8eb7, 0xdbbe96a01056fa3a, 0x5ab75730d48e0732, 0x2de87659be3f585e,
+      0x1beb817f1261cf81, 0x56161a0a17842b60, 0x25f97440e6df6c0d, 0x203d9596bf3b31da,
+      0x94bbe3847c5c3ab1, 0x381ab52a63cde449, 0x1906cdb650e4d3ea, 0x07ec131508a02238,
+    },
+    {
+      0x4b847df5eefcdf44, 0x9ae091c484b6cf07, 0xde5ac0cd0790c639, 0x23aaff4f57a6758e,
+      0xa3c3bac358536839, 0x93ea1a4157fc4237, 0x809916dea823d7e1, 0x1afbead00c32388c,
+      0xb26777e9b7de89c4, 0x35a88201de473013, 0xb81216e8b0fe6243, 0x1eeb1a2ac917a5cf,
+      0x596a3e7134ebb2a3, 0x72ab6da044612a57, 0x3d2c699efe2bf05f, 0x0c3ce696bf092599,
+    },
+    {
+      0x5712ee198302a4d4, 0x2f0fe5f1cf50e9b8, 0x3f3b7749db958447, 0x0003dbb35a9193d0,
+      0x92f604f54ef85df0, 0x39e9d6754a0fa07a, 0xc98d55f551368a0e, 0x2942274dcaefc7e4,
+      0x4fe8cba1b2f842f2, 0xa55fe360339c2e87, 0x31b01be163882f14, 0x2af97ba7a717c809,
+      0x0086a8b62f67e9df, 0x89e28d353f5091c9, 0xe2cceb9e8be41eb6, 0x00a5247ef18d94fa,
+    },
+    {
+      0x695db57f9c718f92, 0x312e1621c0ed84ab, 0x3231c6ee66da967c, 0x062e06708443be04,
+      0x67b16fa49be2c63e, 0x5d1479ead6acd868, 0x930bd17e0019be85, 0x15e8202555ebfa1c,
+      0xebed087857808be7, 0xccdbadd1db4f580a, 0x973d1d7ab20908c1, 0x07e19de61a64351b,
+      0x9693fbc51a9211a6, 0x23c9e5ad54f985f9, 0x69c87b15f045c6f5, 0x26fd960e2cfbc5ca,
+    },
+    {
+      0x296808abdc519c4e, 0x189a96e4c9e95c4e, 0x9fd4d0072b70390c, 0x0bc7b7c68a6cb2df,
+      0xd346bab7165d4b24, 0x6341de061ab0c3c4, 0xeea50e0a49b2853a, 0x1da29e1504950dbe,
+      0x89a80d6bcef5e7d2, 0xd34c2975d0b2d2ca, 0x0ea5fd9527dc86dc, 0x1e395b4bcf995b24,
+      0x737d9d591344dbff, 0x9db0df346854c60a, 0x8b71fadba88af010, 0x138e8debe3c587e8,
+    },
+    {
+      0x20ed26f66d1b4890, 0xe466aceff8f58201, 0x9cadce4a8621d763, 0x1d3b163e6e7889cc,
+      0xf5e4c1d775e118a3, 0xe2ea5bdae9bddcaf, 0xcd2d4441362798f3, 0x0ccf66cafa830d5a,
+      0x43c729ad170f37f9, 0x47a1b643a133ea44, 0xdb17e9c1976ddf91, 0x09ea337e4c0cd483,
+      0x78c6a5dd7b6a3db1, 0x3f723b53a5155d25, 0xe539102062e320c5, 0x16413612e8e05ffb,
+    },
+    {
+      0x2c9d4022e232eaf3, 0xac88a3e6ab1bbe0f, 0x236f2ebf2260a105, 0x05b6151208b01a1a,
+      0x68dcfefc41bcb0a9, 0xdedb67e0ec7eec0f, 0xf76c9a1eb05c4c92, 0x24f1538a9f5f8041,
+      0xc9cf0be428eca4f6, 0xbd2b419e6fed020a, 0x4da39e01d909719e, 0x12ea5c5fa66c78a8,
+      0x55548b62f2e19d92, 0x3f8da70faa798a85, 0xc8fa7cfe604293fd, 0x29c8dcc3adfd9995,
+    },
+  },
+  {
+    {
+      0x2c86732a00b7a347, 0x736a5e867f2a1e0a, 0x171b464a1c4a91ca, 0x0274b915201b2c6f,
+      0xd7b62dbca536311d, 0x6916d45d7923e76a, 0x13bcd19970a2d282, 0x2dc4f129c5ed580e,
+      0x47c8533b76165fce, 0x626f1963edc23bcf, 0xd70bd3e2c284b4ed, 0x1575da80aebb41db,
+      0x052231a7b7e48725, 0xfb814c5be8fa05ad, 0x064526d302b90463, 0x1a68971787118dd9,
+    },
+    {
+      0x770426b2a83db5cf, 0x1df2bd960a0aa34a, 0x23954101040323fb, 0x2106b69b637815e7,
+      0x23e9e0b782e2daf0, 0xe96dee624e06f308, 0xcc24e104abb8dcab, 0x301fbfaa2ec1e4c8,
+      0x8f7776831d6296f0, 0xd64e30a13376d308, 0xadab03a4a5faddba, 0x177c5e1e79550f9a,
+      0xea3746707e989a14, 0xd9f53f30ee98fcce, 0x70881f8eac0e3157, 0x1728c19d18c1438e,
+    },
+    {
+      0xddc3279e4346e27a, 0x79fa3c63892fc5d0, 0xa23db4485cb322ba, 0x2da3f54c36aa880f,
+      0x19ce59b3ca23e6b1, 0xf7bc5a1c48b2dd0c, 0x63eb19eec3327ead, 0x14f9735d9a077543,
+      0x2fbfe9b56ec74b51, 0x0f229692547dfe33, 0xa954f39d03edc269, 0x012700074286a83a,
+      0x19346f2118c3b881, 0x626295ac28ced434, 0xa0bcf1157ed3fecd, 0x1bdb95a1150d8a1f,
+    },
+    {
+      0x066cd60aded0fa55, 0xdf12b0e55fbd6978, 0xfd2521a742acd400, 0x2d69211a69fa9d9f,
+      0x9cf9bfd9683146f6, 0xcbd69db26b763940, 0xe3c444388041722a, 0x0f49e180e19aaf4c,
+      0x761c2e0756a56f4f, 0x1f253612f23b9f93, 0x7107a2fecbd1a0fe, 0x27346976d5cad457,
+      0x3a9c726abe487886, 0x398dc3a67e3e5613, 0xb31c07d6e5f20a87, 0x1a141916d497dc90,
+    },
+    {
+      0x43c5dbac66f08df9, 0xf3c040ab6ac263b3, 0x0ad95386d504e2bd, 0x18d106d92ed28250,
+      0xc05450bb77a8deac, 0x99086b591fa1feb9, 0xbf2a782d7ec85625, 0x26cb38549ae914f1,
+      0xcd875bad6ed98106, 0xd16ef3f24d2f6b6a, 0x77d2dc46e9b601af, 0x2d4f9917f0d3eee0,
+      0x9ed9eaad2f78aa9a, 0xd1e05d0db25172db, 0x6bea5b2608f3f903, 0x21d1034a5bc0a2f5,
+    },
+    {
+      0xa42a98c108b93bca, 0x3493cee762c3d55d, 0x8f10b3ea144a0fab, 0x06af40a2c5865bbe,
+      0x34396e92be71b6bb, 0x46db3c2434c24a32, 0x24186b85f8e5476b, 0x05cd58fb33995026,
+      0x1617fdeff89b504c, 0x94e6afa3a855f5ae, 0x67be1595996db957, 0x0e2045768570cf07,
+      0x404aa3cf16a87146, 0xae0049b18602b6f6, 0xc10297c9019672ef, 0x271c5d780ac39c7d,
+    },
+    {
+      0x909e204501dacccc, 0x1b90464a3849b40d, 0x19c72b274759e57e, 0x038e4c965480b365,
+      0xd17259177f0d96b0, 0xd9318bd0c33c19a9, 0xa8d5b970b5601754, 0x2bd29a2cb6d24b70,
+      0x6178c1812952bb58, 0x280ae15a51afcc30, 0xf5a3d3aa0c559bbc, 0x07365b8850b18899,
+      0x3738817992effc11, 0xbc27783274bc7bcd, 0xe55c1022510c9995, 0x280fda6bb56237c4,
+    },
+    {
+      0x404ea3d3678b44b8, 0x19ecabd3e0a5387e, 0xfd8d93d50f2ba58c, 0x18d7844c4aea1949,
+      0xca35522ded1c34e4, 0x8fb064a2cf12faa3, 0xbc54a9576631655e, 0x06205355557675ba,
+      0x4d662d6e6f71ade6, 0x1513f0c98273fb0a, 0x3d0a8ac3d8a0f8cb, 0x14664a3f8898cd3f,
+      0x9be14f4cb9449292, 0x435a2a757a711f67, 0x49c8e4cddc4b1c73, 0x09abe9e28eece209,
+    },
+  },
+  {
+    {
+      0x5fd704407b1f1fcd, 0x95ecb3e747cf5fbe, 0xb57d8f7943221750, 0x08c812fc1746fc55,
+      0x9aa9127675a79a2e, 0x769ecf5649e4f74f, 0x518f7f4a5caeed1f, 0x295e8d87c4b4b312,
+      0xb820a308f246f8f9, 0xd19577912032c097, 0xa250c9405813c42b, 0x0ebe646fb72500fa,
+      0xec2ab4db0c3212b1, 0x7a05f1e6abaf7c6f, 0x7a32c7fad54e3ee8, 0x2969ad35b9d5dc4e,
+    },
+    {
+      0x62f5ba7836794d74, 0x1e0cc8ca368c9ad8, 0x03aee64b7475fae6, 0x2886a8675f81046f,
+      0x7b817bd79c460712, 0x7659bbd4a45667ca, 0x4d70fa6cb3255901, 0x27f404259a6f5c76,
+      0x006b5f6ff846527a, 0x178e540fed1fa980, 0x4965353f0750f8f4, 0x2ef2fa5ed5e7c106,
+      0xb91409744bbe4a9c, 0x3a7f6b954758286b, 0xd4b5bb91fa1a7483, 0x19fdea5ae63ff5c7,
+    },
+    {
+      0x050c7df61d416e74, 0x1479267ec1829522, 0xaa4da49d4dc59147, 0x1031531818a24ae1,
+      0x0f9eb33c70f06433, 0x3dc8996f92102871, 0xa2f64b6df7b32f78, 0x095c8bec78f7e9d2,
+      0xb657f7179b5a7e92, 0x32e356194df1c74c, 0x3c439da139e64702, 0x06ab4e47b8321964,
+      0x5a56f48e6cf8b6c3, 0xc3b6cd37e8b26105, 0x6f59bf82415e99bf, 0x27451a69206b8c12,
+    },
+    {
+      0x16f8a5c62d730055, 0x98a05c3ce21e7da0, 0xfb6e1a3a4086b336, 0x12b2b867967e8521,
+      0xf49595c744a4c449, 0x9f0e64d7e3138210, 0x85272f0d92750a8f, 0x1f4f01088ebbfdaa,
+      0xd42950423e0d8b0e, 0x168cb0cef328f0d2, 0x7e69c7f4148b4174, 0x09b20fcd4e20c3a6,
+      0x2c82e324a2d6ee35, 0xd4a52d0d16df4b99, 0xb913aad12970a745, 0x084257f4875b117a,
+    },
+    {
+      0x54a68e59df88b0cc, 0x3aaee056ff1ffa25, 0x2cee82ec1df7ae53, 0x0449a049401d4aa5,
+      0xe04a14f3f6d047b2, 0x9286d5a797bebeea, 0x3001174089859d72, 0x234351a943e68a30,
+      0x8435291d0c82412b, 0x2c3ff715e1f11526, 0x34f3ba3f3faff796, 0x1ab4551c767b8d68,
+      0x9280f6220d243c75, 0x4bb0152eb01e01b5, 0x47af4d00322c3484, 0x09f9e589fa5f44a3,
+    },
+    {
+      0xcd8ade314189459e, 0x568c4e661ea7fd2f, 0x76255ef7dd725ddd, 0x09e93843d822f5fc,
+      0x648e02ec77e7765e, 0x5d8703da10fa04c3, 0xec0ff9511e4b503c, 0x1ae8b0dcfe006509,
+      0xd1ca7c48d8110fc2, 0x1220934adbe3dfc8, 0x2b3a19d248f988fb, 0x1337bc34e4d38b60,
+      0x4aabd2e536f2a74c, 0xad47cd7a2b2d82d4, 0x8d9fb3b2b78ab9f9, 0x26aafc9c351b409a,
+    },
+    {
+      0x4caf48a0091ba6cc, 0xe9659f08a2029b33, 0x92aed1527ccf691d, 0x27af67544ce6d234,
+      0x9f495a9707323732, 0x52ae169a286768ae, 0x5ba15a0635f18338, 0x03373a2c2b50414c,
+      0x68309312fa8ae755, 0x854586b1db95d735, 0x49504be12173d9fd, 0x10bc903e4bb20119,
+      0xa4390a21d19ded66, 0x52a300c3e4f64021, 0x479df8ffee57afd0, 0x2641e4d0c07b71c5,
+    },
+    {
+      0xa9613282dac1b3ea, 0xe499ccc1f6b7598d, 0x02bd6457e580ccfa, 0x1db676a25b33af41,
+      0x37a2f362b651ae33, 0x1763062079a02e58, 0x054c389c5eb39bc6, 0x0f8c1e4593375ce4,
+      0x69be4ab62b76d21e, 0xc17dd490cb264395, 0xee186b6f83f1e5a8, 0x02dee4c2c7763771,
+      0x11197ba62fd0fd13, 0x4ff9c90836cba7fd, 0xb0950f73ddbca973, 0x17f1b7ac5a4719b8,
+    },
+  },
+  {
+    {
+      0x7c44505c3e08252c, 0x5118f9e6ff8546ec, 0x6fb7ca2ae14b96a1, 0x147fcdc63963964f,
+      0xe8e01a032a104208, 0xcafb579fe332d57a, 0x9e503803673c6c92, 0x25502af4d995aa11,
+      0xad8487c031034608, 0x5c6c5144498ecdd4, 0xa2b2f67a828c2e4f, 0x27eb55f2f8d0dcc0,
+      0x44467b36a9ccca14, 0x59b473804c93df3b, 0x8a3be8eb41ed754c, 0x16db29a1a3e051ed,
+    },
+    {
+      0x8af51b27a9fe0d59, 0xccb43ab04e363383, 0x16de2abb820df974, 0x0084738f52218303,
+      0xa2cdce9e047781fc, 0x41edc8f75b3cd41a, 0x97cc81626bdff8cf, 0x0f6182a0ae7b7646,
+      0x90933d620b675c4b, 0x98a5afbe564f2d33, 0x137839bf9461eb78, 0x06605e80bc509b02,
+      0xf6ffc2513250ca6d, 0xabdb3cd47ce89623, 0x5a7d927ba7b69763, 0x039ebb0e6bb6aba4,
+    },
+    {
+      0x19cb50f64e5a7a0e, 0x70bf487afd37e7bd, 0xfd5505c007c6a277, 0x24dac84a0aca85e6,
+      0x383fe6f3c98ad8b8, 0x50d8f35252164d7a, 0x902ebf3cba7addda, 0x300b961323e2f7ec,
+      0xb0b9428d95ae10a3, 0x19ca18a8ecdccf32, 0xbcbc8355d0ac5dd9, 0x0fe3a97692c40ddb,
+      0xb7be1f20bb02a303, 0xcecc399f69f5d764, 0x903f48a582944b06, 0x2ca8e35ed52dd697,
+    },
+    {
+      0x2ed128bb99359058, 0x419d6173869ddb2a, 0xd9aaa53493f7fdf4, 0x16a9363b0fae3e9a,
+      0x00a5b92fb8e21525, 0x4f98445d564137ec, 0x0662fd347610b27f, 0x2a7bd90d743ba3ef,
+      0x5df1eb6ce3b93fd4, 0xf46236b0ca9b822f, 0xdf2436ad7d479169, 0x15f12d19ff5e08e1,
+      0x6f907a75a3edf5c8, 0x29240a90d4257494, 0xf68c68033959ed6d, 0x0aef3efc794c8d26,
+    },
+    {
+      0xea5e33905d759e3e, 0x06e6e9b21d800151, 0x45ac9ac46b883103, 0x293dd19a515b1744,
+      0x172006027eade8f4, 0x9c984ea8908a622e, 0x5c3b27f7faa73f40, 0x267a893db098fb38,
+      0x93ba58d09c75b704, 0x08403ef9861f473c, 0x055fba0e0007da97, 0x00bf7998de50de6a,
+      0x5f8a34592a09f951, 0x07b49a6ceaf835cd, 0xb9889d9ff7825429, 0x1f5940bd8a8ff6c0,
+    },
+    {
+      0xac10ca7f563cc8da, 0x5acaed8c1bcad9d6, 0xd12c1e60e16f4a68, 0x2a4d924f8809d6ae,
+      0x59e6763db9cdc4ea, 0xf5837072aa3b55af, 0xcfe610f5cb47db6f, 0x0a3b9fe0f1f79b89,
+      0x3e177990cee1a5eb, 0x57b4827a372e2b4b, 0xfe08d4fa670fc73a, 0x2ddc7925d9476dab,
+      0xf2f7423abd1f4c56, 0xc5dd4565faee510c, 0x0819023a87fc63e3, 0x2f9feb5208791955,
+    },
+    {
+      0xc5287edffe0c35b1, 0xea993c39a1e5f784, 0xff91f3be60afae12, 0x2f87368095c81209,
+      0x0a047581149b0ff0, 0x4e7bd98490c39d79, 0x67cd9a1a9b766471, 0x1750d5d687c1c6cc,
+      0xfefcea8bce75e732, 0xfd5724823f0bb0bc, 0x4dd3702e763b9854, 0x2fbf007558ac866b,
+      0xdee06404335d0145, 0x0669458eff0ecb75, 0x182157329b44c256, 0x25c44e525fbc3f78,
+    },
+    {
+      0x65d7a54ca67f5936, 0xdddc11cf7fc927ac, 0xff198b11377ee467, 0x0446018b88096aaf,
+      0x79d32c3a7c210d1f, 0xe12eda4938129117, 0xdc124f453558dbfc, 0x0358501e3cf84970,
+      0xc8fd1ee25a96c5e6, 0x8fa49df7900720fc, 0xe1276b8851f81d2f, 0x2ec2eee988955e2b,
+      0x7bc995895e0d7461, 0xc0d2cdc0702d8bed, 0x46759adbe6518bfa, 0x096b7c9d170c4f2b,
+    },
+  },
+  {
+    {
+      0x4b4b30fbe3a94e0b, 0xc9fdf195edf2d855, 0x1e6572bebd77adea, 0x063068064c9bd388,
+      0xa88646bd53bfc80d, 0xa113f769c947e563, 0xfe4ae1034d2a02f8, 0x23693fbbaed44021,
+      0x8ba04864072a7d13, 0x6839ffddf63f5d72, 0x5e38be5db8f37072, 0x1965a283a9883fd2,
+      0xd2321424552efa1e, 0x0e3fc38e18246184, 0xb64e374f6d985304, 0x2ff3c00b15606ab3,
+    },
+    {
+      0x89f7f19ec08485de, 0x2947efe638deb0e8, 0x796e17d73a604fb1, 0x01273c6ae361f36f,
+      0xadf255508383316f, 0x86e99f41b26e115f, 0xa55a6350c2cd11b3, 0x29d3b1a4c8b1f272,
+      0x776358740999d697, 0xa3fe3b326f6a460f, 0xb1eba47d9963e310, 0x1545195ef00a7068,
+      0x1a64c34b4b4459d3, 0x3cd577e1383ab39e, 0xb1adc85c08b68f58, 0x1956bb8ab496643b,
+    },
+    {
+      0xfde83e0997983376, 0x5a988d41be42519b, 0xd75429f93ab63068, 0x21d63f7d07c836f9,
+      0x62b6c1eee2d1166a, 0x43f08d7d0685868a, 0xf5bd05c42a3faf52, 0x1748e10631ba16ef,
+      0xb486fc939fb26539, 0xcba8c8aace4dce0d, 0xd718f41fae479b8f, 0x036eda3aa6505b06,
+      0xe49e1e55526d7583, 0x723e7669c8b3daa7, 0x2c52b9b50c597c9f, 0x213358d153ee465a,
+    },
+    {
+      0xc8deafbd13e6b280, 0xaea0ba349737f8d9, 0x6313d75872ffa399, 0x26401e6ffecf11e0,
+      0x0f1f049a4c54ced4, 0x6655cde3a87db83b, 0x81626eb5bd96fff0, 0x17000218184162af,
+      0x9495ba5ff4f79cc2, 0x4d71e26f83d596c7, 0xbc411a78e7665b5d, 0x10bc2a5ab12bc8b3,
+      0x45636f9cc37bc713, 0xccb9841257062b12, 0xa460408c51e3089a, 0x0c24286799d7486a,
+    },
+    {
+      0x7ecde3a062ad9705, 0xf662adf9e79b288c, 0x83d1cf7e2de84828, 0x0c00f632f5908355,
+      0xafff5a489a2a073e, 0x7d47b19f67608acd, 0x51972557bd09210b, 0x088aee9cb4a6efa8,
+      0xda3329296e5dc3ef, 0x4358781f89902d16, 0xb2416e9c2618714f, 0x1755a62d28c267e2,
+      0x9078c0930be4d23c, 0x17b25006e39a252f, 0x07a7b32a42a20337, 0x07dbb4d44bef394a,
+    },
+    {
+      0xb683d0e2c00d8e8e, 0x99a84467327fdb90, 0xc82ae4f49f4795bb, 0x22b174a2495d6341,
+      0xe99ad26a9e07d437, 0xb0796d0074012d07, 0x892dfd107506529a, 0x0f07931d78686c15,
+      0x056b61d08a219bb8, 0x5714ba0c7244d32e, 0x60543cd5a33ca379, 0x2352f52e79ae284b,
+      0x5f65f2dda2a8fbe7, 0x497b67cee34fd39f, 0x37dc5391e44d922e, 0x1061a37e57a3e6f2,
+    },
+    {
+      0x00bc636f5e516095, 0x31274dc2ae99a4a0, 0x9d89a90e7100f0ff, 0x24eba526db98d760,
+      0x61c2a8242a063fee, 0x68808846a3ff3041, 0x856e33526b9047e4, 0x218335513f92c2f2,
+      0xf104cab5abbc1f21, 0xb54154a58ba706d9, 0x007862a2f322d53f, 0x23546db9730cb8eb,
+      0x2cc23c5c6eae8fd0, 0x885d5d110503dd67, 0x1a65ec69510e21be, 0x144dcf62c480edae,
+    },
+    {
+      0x439d754fef2c9e43, 0xe21899f8e4d86ec7, 0xf82e6b52eb017e4f, 0x1ab621c7b75df65b,
+      0x37f8cd8d7d6afd60, 0x748421eeec62505e, 0x380a94e357b06649, 0x024b8f575bc4d960,
+      0xb575c2a63e30daa0, 0x1f3f37b625bc2dd9, 0xd1128a9dc70a3dab, 0x02d81811d5924f58,
+      0x24a570be06adb266, 0x5e3ecf9dddbd6689, 0xd07817faede8f881, 0x0d31728bf7e4267b,
+    },
+  },
+  {
+    {
+      0x96e9b3ef3c55a77e, 0xe704c7a56ee0a72e, 0x476f5cf62f6130df, 0x183486a3dd065dd4,
+      0x658d2568af787462, 0x447561fd36033d42, 0x9cba965f6afee42d, 0x2ee674b9e15032c4,
+      0xfc5952281791d25c, 0x8031dcbd1facdec3, 0x7e45627d000dcc75, 0x21c8e6738c465f83,
+      0x494cb5cdbfced07e, 0x2edfe071d246aafb, 0x0704a66d676e021f, 0x1273ce0dc1ec96da,
+    },
+    {
+      0x53bad657f51a9860, 0xe8c9dee5ef9cfabc, 0x80cc323d2df04d94, 0x010c3a6bbec6bc03,
+      0x499698c96589f5b9, 0x3ed5266dee53d467, 0xc9b037f6827038ad, 0x0feb3f89f04a4e0b,
+      0x1fcde7b608a95e8b, 0x7cfa1c37a90b3450, 0x64052d2b565b7fc5, 0x168aea88bac1aa68,
+      0x462aef185c2182d4, 0x573f8f6f657b1960, 0x03328f63163e38b7, 0x2f364038fff46d2f,
+    },
+    {
+      0x3568526ff0456a4b, 0xa6d4d905ae027ad1, 0xd76b69738176d803, 0x025268c411fafc77,
+      0x8608a2b89317a124, 0x45dc4741941db173, 0xdaf535939d253e6a, 0x04c97ca4f582be46,
+      0xaf78f92c3b40e69f, 0x4c26012b3cf1c5a5, 0xace40754bc316b89, 0x24ca19943811cf83,
+      0x3d43dd1a110680c4, 0xad6d6e96495e6ced, 0x387b1ec6496b5d42, 0x27ac3d8606718938,
+    },
+    {
+      0xf6f160c4f076eb9c, 0xc1c4e136e85c222d, 0x28da40d9af815805, 0x22b924a07bc3ebcf,
+      0x0fbffc323736cc49, 0xbe34acc91a545e1f, 0x8100b1a59bb9167d, 0x014b1d57b4d7c81e,
+      0x27738821a49ab211, 0x0261100a302d0942, 0xdc3e146e2ce3845b, 0x0a1f73497b851f45,
+      0x628e7c9df1c24c42, 0x131f3ab0e8d74f14, 0xf77795e6123cedb1, 0x16efbc82a5ab5808,
+    },
+    {
+      0xea0f27cb3bfc9491, 0xff756f8cf51e3f33, 0xea03bf5ebcf6f936, 0x2ab08bddf2dc8564,
+      0xc3563adff1d7b9bf, 0x3d4bb88f263b2d94, 0x7f41a9ae4a4f445b, 0x18133c759cce62c8,
+      0x51aac7c5cc1a055b, 0xc84b7bc1141f2446, 0x78cc01b173fb7f86, 0x0b1783633f0ab293,
+      0x43f989403d9e83f9, 0xdeddd4125bdcb0e1, 0xefc9c88bb70f7dc4, 0x2250e1a7b59488aa,
+    },
+    {
+      0x6dee9055a5f3de23, 0x6d1b2a3beacc0983, 0xb152605a6e32f4d0, 0x2041b11718b31e20,
+      0xc080401761daee5b, 0x1dc61f526e2a9b8f, 0xfa7b5cdceaf6bae2, 0x18cc6d5d207fe364,
+      0xb396153c0aa26ddc, 0xeb119da04f340d11, 0x4599f6dfce011470, 0x1a6caafe6f55cbcb,
+      0xec68586d88a2312b, 0x2ea03a9569344d2c, 0x677fa138daae2170, 0x2c85a05965603299,
+    },
+    {
+      0x302c316f9c44edd6, 0x675665febdce3843, 0xcf3ddf4629e1aa10, 0x271c796afc3ff410,
+      0x4fe0dbfb9071b21d, 0x361fcf7b89179ab7, 0xb839ec77282cc24a, 0x21d091d6352e8569,
+      0xe0740fda22fada32, 0xd690ae4e247b986c, 0x23f8dec124411d4c, 0x22afd85ef1b132f1,
+      0xe008b12434312145, 0x80e1a18f505c1bcd, 0x311373bc06bfd736, 0x10a473b388e3226b,
+    },
+    {
+      0xbb28f3966561e688, 0xd7971aaa2e584893, 0x9007b190d3842b02, 0x1c7982e0ad4a66dc,
+      0x244fdc23da5127da, 0x9b1c31f5885a21ae, 0xfa27aeb1d6150ec3, 0x28c7c54e8044135f,
+      0x27891bbc83dc49d6, 0x53f8b0e473e7db2c, 0x82e6c314fb285d28, 0x1f4f928e0d46294b,
+      0x90f3ff3c83f3c3fe, 0xe0598b5dd347987b, 0x41050c5c34be7e49, 0x2df8b438ebe6f7fb,
+    },
+  },
+  {
+    {
+      0x33fad769fab3d16f, 0x2d42666686e57206, 0x924cd7e26c499027, 0x0dd4dfa3dd5a33c6,
+      0x58e7083f6758cd3c, 0xc7f9dfd853148ab3, 0x4c0dd66e05eb1ff4, 0x02c5455bbd9b451a,
+      0xe05a0a71dcd366b4, 0xc36ce62067ba53a6, 0x78f2620ef578f158, 0x1e6050b322b8ba76,
+      0xbf8a23dfac9fe47b, 0x6388dc6a7ed9b518, 0xdbe82ca5dccafae9, 0x11ec4d72d1426832,
+    },
+    {
+      0x55365ec7fac9fbb9, 0x6b49cfc67926a80e, 0x7ee719e5cdd2b9b9, 0x2086af7e30792f95,
+      0x2b1dbc284927e80c, 0x918ed6d0e999b5e3, 0xc42701445094e826, 0x1f6849c0bee2884e,
+      0xc7d052b43a47bbc5, 0x083ee87bb7c169ac, 0xb897a6d2e310da9e, 0x28308292a2a77034,
+      0x596e546fe10ca6b0, 0x38e904cd37b26c59, 0x23c5a86534068a76, 0x05a3d4e419c9929b,
+    },
+    {
+      0x6c48178fb096b565, 0xd53b09c95e22615e, 0x983d87ce525a6fb2, 0x07300a7e9149ed7b,
+      0x51a8013b5828c4f4, 0xceb0a679390896b6, 0x92073f86bbb3ca16, 0x1b0378c523906d0a,
+      0x80a199d0fc092cc0, 0xa9121ee1a20a5396, 0x2c70019dd9b0b0ff, 0x04ef09421e20613d,
+      0x1b83419a0df23768, 0xa11fedf95597d3cb, 0xbaf0cd2e7b6049c5, 0x212fe96d526bd217,
+    },
+    {
+      0xec6329d6416e6e77, 0xc9b42669eb2cccee, 0x9fe9abef5dbfb524, 0x295768c786741507,
+      0x686cb8a3884aabda, 0x522456858278256f, 0x5a20d3be31b6da55, 0x0ce2c62036d5bbf5,
+      0xcabab6b381c62352, 0xc9105d88c7ee5338, 0x52c0bab7c3573762, 0x1db651edfdca44c6,
+      0x2d4f781778203618, 0xbc5ee486018400e2, 0xb0de08a46cc6686f, 0x00bbb92f69bde5e4,
+    },
+    {
+      0xb60ec6fa837592ea, 0xe07ca756344cb448, 0x3a4d015aaa329c01, 0x2b2b79e568f90970,
+      0x17521aa695114a38, 0x642af632f120bac3, 0xab0e441931c22222, 0x0aab89122b4680bd,
+      0x0ef13e1a95c01a9e, 0xb70697486bfefa35, 0xbb2960e9f2230005, 0x03d1dc85c7af238a,
+      0x7dbde19a32b1fd79, 0x6f8b72a80b96e550, 0x57af85a6341fb24c, 0x155726e0379f782b,
+    },
+    {
+      0xb695c90220b1e40c, 0x1a407b4191d55377, 0x3d182965328bbf39, 0x01d368b555fa1ae1,
+      0xd69c38ec8755a2ed, 0x12255c3db87813b1, 0xa363503d3c5d2d80, 0x17886e2b24118086,
+      0xeef5cc669e61bdf2, 0xb03f7f3c4f3968e0, 0x8d4db911db819683, 0x2cfd202da7b7e5bb,
+      0x905d837222a0570c, 0x68e4b21b8afc2d30, 0x1b2057dae78b8aa2, 0x213dccb29813c997,
+    },
+    {
+      0xc2778e6391611415, 0xab6bafeee829559d, 0xad913b17cbbda514, 0x0cf4ce5b0f88b6b6,
+      0x44d5568b7f2a4ad6, 0x16b533bac314f9dc, 0xc993cc3df4f5a2a5, 0x1ce48b6f04c2eaa9,
+      0xb9abf6c1e0dad8b4, 0x5a61f50439fe1021, 0xf335b80e404ed8e6, 0x29cb55b60778f00f,
+      0xd0df55110000ed6e, 0xbe26ae23eedcde6b, 0x38afe3bd7dd0f221, 0x2d6b7baa452b2963,
+    },
+    {
+      0xdfdc8b3538b46da8, 0x43cd2ffb87f8faab, 0x3b9eeeaffbeced07, 0x1f6d7064ac040659,
+      0xc43daf8a1e5c86eb, 0xc33213335e1c0331, 0x05085f3b075fa1e3, 0x1d49233758e8375d,
+      0x024c8203a7b9a545, 0x7b5e18a8bb57dba1, 0x47d6c13d08fe5c71, 0x183fbcd7dbca3970,
+      0x8a47f7989e14878e, 0x6b6a11fbaf6acb10, 0x3855e1f3463da371, 0x029658dddd009423,
+    },
+  },
+  {
+    {
+      0x39fb029ed00c3292, 0xc17cf2f8ae10e41d, 0x6f656c829996880d, 0x2ffd39f8919f4fa8,
+      0x21280050651e0946, 0xb4fcbf725855f6f9, 0x0bd1d428f6d4bf9d, 0x181c9834195433d6,
+      0x92b997ee11c09377, 0x09184d416af1517d, 0x539ac1e5c06f99e6, 0x0ddf3b6c6c76982f,
+      0xc45b6d6f909c8176, 0xacc442436b26a159, 0xb3e059cbfb94baa2, 0x1430b6a9f9aa7a3a,
+    },
+    {
+      0x423b37bd949cfe84, 0x672399664fb7218d, 0xf40707e972dc7d00, 0x0ecd54dd945cfced,
+      0x0170438de4472b65, 0x74e284ed0fdf1e4c, 0xc8717e952d71ba48, 0x2a2b2ec320e5021b,
+      0xff513c1f1179a010, 0x6b25a55a8b7f0664, 0x4ce8ff7bc9980263, 0x0729f6b6d9a6543f,
+      0xf1ef373e907fac8f, 0x3c82d2ffc38a8014, 0x4a7a9d709374aadb, 0x2c5de048ad11e408,
+    },
+    {
+      0x958709e28d4a55b7, 0x7c636fdd10a44407, 0x4ca0e55028a44c74, 0x0295156f92f5a98f,
+      0x904aa7f8003dba77, 0x2d376036a03e487d, 0x584e94b095cc2b6c, 0x18e44d8684768c86,
+      0x1e41ba7e4e7bcf66, 0xd7a4b330b0bdb90f, 0xee05fc7a72e7a331, 0x1f294bd7c25c3094,
+      0x3b1b105760d3a3fb, 0xf80398b7040632ec, 0xeb67fc506cb02e54, 0x26c6738ea6d97fc2,
+    },
+    {
+      0x2bd51979f1bb0ce1, 0xfe998fe39841171c, 0xd1125d9e8f7a6b12, 0x0f163cf70d8aa37a,
+      0x370e71b2fdaed6c9, 0xada5861bc9b01d30, 0x252633a568eb32aa, 0x1692c757294afcbd,
+      0x8f8b17f89d25008c, 0xb336b34f7666bf42, 0x8c155719ca0b0c51, 0x0bd8aabf5a4754c4,
+      0x7b2296c11a005726, 0x0166256afb3af239, 0xf94fc48f00a6add9, 0x07e6d3d3c857caeb,
+    },
+    {
+      0x8461640bcc556ab3, 0x9387266f6ff90e06, 0x20314645f2b9408e, 0x2d7161abf5a74fa9,
+      0x4007c3d09dec5c14, 0xabeec73822286cff, 0x1781a73ca2e3b747, 0x171d55042cab23ed,
+      0xafa6a95908634029, 0x9d272e55c288a0c3, 0xe5716f2a7d2c8e6a, 0x1145c9f3bbcbd462,
+      0x704f858b19a66d70, 0x7393ed04059699f9, 0xeaa14f408a14fdde, 0x15b636533c915934,
+    },
+    {
+      0xebe6da4e05e292b0, 0xd90f36145f11bb9a, 0xf4c19b060f08f90e, 0x272c4d9a2204162f,
+      0xd1b1ab5d23d31d62, 0xf56894046b837137, 0xad813545391611d6, 0x25d87f67f0315d09,
+      0xe02124d671305e62, 0xecb470b9d858b623, 0xeeaec36d85944872, 0x27865bb818fad81d,
+      0xc8210049dd46eb20, 0x4a14c06c0fe20680, 0xb31559a44606387e, 0x22d2aa9beca9af31,
+    },
+    {
+      0x43b95125f3dab322, 0x479574c1c2dd8ed0, 0x6b7a3b5382716c86, 0x08568ba84716cd9f,
+      0x98ec5b9583751d1a, 0xa07e666433492e13, 0x31c1694dd372701e, 0x02444ee495d5f42c,
+      0xe3451f539a4185bf, 0x89c67a760f29236e, 0x7faeafbe33b3bfa5, 0x2ca2398c9794ec85,
+      0xcfdc9fa66a1c2512, 0x6127803e63ba1dde, 0x48969122a584a6f6, 0x1a893f9842ff8f96,
+    },
+    {
+      0xab8d505cb31e5731, 0xa5b312450f69d76a, 0xbacf8153e6fbe63e, 0x2cf3cd4cbdffedb5,
+      0x22ec5ee37987315d, 0xeef1ae2d2b9fcf9f, 0x25a8f6317a33399e, 0x0d297c981a3d1d16,
+      0x49718cfefcab694e, 0xb362601863906507, 0xac950432dda053b8, 0x299077f39d121649,
+      0xb1a82e6f67b16873, 0xc9ca566ffd093be8, 0x2ff108bbcab170df, 0x2efb9294325bfe60,
+    },
+  },
+  {
+    {
+      0xdfeaca79564f24d8, 0x32f31b101dcbe83b, 0xfc4f7f98c9fefa9a, 0x1e75c5d8cb58063e,
+      0x5fc9733961b94d69, 0x250949a14ee9a93f, 0xa3e077a992d7b2be, 0x0fc9fe2b8a8f2219,
+      0xeed2e4a15d37115d, 0x2cf7dc9fe3de0553, 0x20b240dfd2bd2731, 0x0bbd31b305d90dff,
+      0x2cae0bdc8ccbaf82, 0x29b2cc23d46b3a41, 0x09b81fd980edbca1, 0x0fdeb5ce19922646,
+    },
+    {
+      0xfa23e804e0b61d33, 0xe80db84456593669, 0x336ac73a4e3e229e, 0x29f2a077aa5fb810,
+      0xfebbf8f6f4fd3efe, 0x56c4113a7773c828, 0x1e2e8e6388b9ac93, 0x1f2a35ee9332ce6b,
+      0x420c668a0a6f974b, 0xcf7e93eea5374522, 0xcc880c593d65770d, 0x1bb26600771720d1,
+      0x984801e1bde9f501, 0x222f72cde5ecc13e, 0xc55235dc4983a779, 0x161978f1e16068ea,
+    },
+    {
+      0xe09838a9db2c69a0, 0x2e776ba3ac5d8212, 0xb7df23773630b86a, 0x2bfce9823c0d6512,
+      0x1da20941bffa418d, 0xc780400d3b4072fb, 0xa01e6a168ac645dd, 0x174daeff8b59b943,
+      0xe0a35bef0433aef4, 0x7b81bf83a4c64061, 0x16dfd91653b8484a, 0x06f69209ee922953,
+      0x4de7fd0ef85bc6f3, 0xee683891bb226f42, 0xa7fff4acdc66126d, 0x0e718dda201de8e6,
+    },
+    {
+      0xb30de357f9068032, 0xe1cc82e8ed847ee4, 0x2b907c36b13fb74f, 0x2f6ff56a39af7e65,
+      0x021bf71160c34d94, 0x87dd81aea0575005, 0xc39886a8b3640d47, 0x1aa1326dc6a005b0,
+      0xb7b2c35ebffadd12, 0x45ee2a1a2340deb6, 0x0c9e8f1dfb4c415e, 0x1b7e6fc908bdad40,
+      0x542f85d545bc55ba, 0x474a480cade9e80d, 0x39b7ce9636ea4891, 0x2113905e5f881281,
+    },
+    {
+      0x1ef9c3acffbfa9a4, 0x31184e205cb6c6b4, 0x490c9a16747d8e32, 0x0ea8be7f1cd2b40a,
+      0x5a287288904e1e87, 0x99cf115efcb96999, 0x0bbec7c4ea020a9d, 0x29b5a029b2d03a9a,
+      0x04c506b5f00f8027, 0x8c58a349eac0de05, 0x0a7954ff4ecd30e3, 0x2c7712db787c2b02,
+      0x551eafb6af585f90, 0x1b569dc3ee2249c2, 0x120da36e28206e66, 0x1d2ef21c9269bc6d,
+    },
+    {
+      0x6955306532a8a414, 0x2c2f771605dbfb9c, 0x966db6779abe4eaa, 0x28bc0ac2a671c86b,
+      0xdc750e3b230bda2a, 0xcbea099185cce4b2, 0x4c27a86d984d39d3, 0x195fe9ffecabb3ca,
+      0xc5ce67462abe577f, 0x34793f65d3183cb2, 0x5227d12e4bfa5223, 0x25b0448928ffdaec,
+      0xcb3857335cb0a4a6, 0x62801dd966cc2780, 0xc9f3f27ea11663af, 0x222ef547f1042c8f,
+    },
+    {
+      0x8a172b11c45b03fe, 0x8fc5ed7ed337b93a, 0xe2a36371d3b554ba, 0x1b73e92835932ee3,
+      0x4aa4b2fc1feb9892, 0x00e20329a6b63cdd, 0x670933b9c2b2a948, 0x102e8f63e6538671,
+      0x1e2ce0fb81912014, 0x66530002f8fc5e20, 0x9edbc57990704aa6, 0x2a57d798f5d249e2,
+      0xcb72ede85b1a5c14, 0xe4d6f9758732c839, 0xa7db25bf0e94bcee, 0x0c456a2f9b4a4600,
+    },
+    {
+      0x0ec1c7153c051fd3, 0xad787b2096110611, 0xacdff1038700d99a, 0x1a227a036953c55d,
+      0x71104769d00af8fb, 0x04c0b614714a080c, 0xa486ec8deedbf17f, 0x0b666f50fd0cb80f,
+      0x98b52460611ebfd6, 0xfc2909c7ad14ee7e, 0xa12392a7a3fa11c7, 0x10903f56b99b2cf3,
+      0xd04b3bab4fdf9c8d, 0x277eb243d4270512, 0xa736a15d8263edf9, 0x0f252dea8efce983,
+    },
+  },
+  {
+    {
+      0xcea178917780e285, 0xa33503b0508d8f53, 0x718ea9f47904cd78, 0x1826e8226c55d56a,
+      0x9f04f23ef9551edf, 0xe4e7bb08d176fd30, 0xca8e48fed34047a1, 0x2da95c4fd4d31ff8,
+      0xa9bc6bbecadde0ab, 0x2445b6451dde420a, 0x429a2dc6da46609a, 0x21c374ab43297f76,
+      0xd565d0e9e9d49e88, 0xb17196cddcfa5232, 0x26532749c1d9cf32, 0x0df889dbc14e44bf,
+    },
+    {
+      0xe96b00fd5f9aa091, 0x18e2cf60ba083956, 0xe8dc04c30b621402, 0x1c3b5f88c4b9db21,
+      0x3abf06b54d97c6b1, 0x47f52d8b5ccd22b8, 0x3caee9cc0f649a4e, 0x2b2d989452e75bfd,
+      0x1e2961334b9f5960, 0xc602356da43258f3, 0x8f067dc30a04d737, 0x2b91dcd814229d9d,
+      0xd1dbcff2f17e35d9, 0x099df3f6f4222353, 0x96aa46dc32aeffed, 0x1a6f150c8bd9a4e7,
+    },
+    {
+      0x7bd0a120c1fa08ca, 0xb2efc5988d8e5938, 0x33a4f61c7fb29a5d, 0x164fd6e61118e0fd,
+      0x93ea2914baf7b4b4, 0x3ade47cc3105e57c, 0xdeb87559c3083ecf, 0x1e2dd77c034d8bba,
+      0x8642a0abbafcc158, 0x256a3d044c93f490, 0x567e050208fac296, 0x188890b0298439a9,
+      0x7d3d35e487c02636, 0x22d5ccd872591fb9, 0x261d160cd416c138, 0x22f58f0c5c0c6e26,
+    },
+    {
+      0x95877aa7d4caedde, 0xa0bcd4b904fa6ad8, 0x1666fb8e52fd3a77, 0x2d7c5427806c88bb,
+      0x0976b6108bc97ab1, 0x66d33a92866630cf, 0x7d068be959f256cb, 0x15a3c7d893fad05d,
+      0xffb3bc250c39727a, 0xd8e99c7c40e47a41, 0xf5927fa0a9e6d49c, 0x292bef39e5677c5f,
+      0x539e70172306cb91, 0x74d95efcffb95cb9, 0x9c506ee95644fb40, 0x22c8688232d623dc,
+    },
+    {
+      0xd2864af90c0eda91, 0x81962e79d30422ca, 0x241647b642976ca5, 0x2c821cb76d6b46f2,
+      0xbd185d03b8f4d100, 0x4aef105da27c56f2, 0xe52bcdd5a9fbb344, 0x2dfb219fd09d2126,
+      0xa62c4879af3426dd, 0x588deec54162e3d9, 0x5d6af12562425071, 0x21692946a3064538,
+      0x2e2afbd37b92cb3b, 0x034da646a61f665e, 0x5a23422f60fa715c, 0x1ede53b52878a704,
+    },
+    {
+      0x853f0271f5ebc77a, 0x5f20a0fbf241fa07, 0xd558b2bdc8f7508f, 0x2fa038f9494bbbb8,
+      0xe50f936521604a3c, 0x6eaa4a0e947fa8b1, 0x64130c98f4ccde9b, 0x0e972b2825026591,
+      0x20ebdcd7395087ea, 0xd010c4fed41b92e2, 0xd6eade86d5133ed2, 0x135d6e9ab89145f5,
+      0x7e1820c9c5428ad3, 0x643b05f7c4dc697b, 0x2576d83a3c77ae02, 0x2d012c380d5bb720,
+    },
+    {
+      0x3843c4583ff9769d, 0xa09f7536b50d99f2, 0x02f9e04a189618bb, 0x2fdf0d29862febd5,
+      0x627833dc8bab03bc, 0xee5a3f8c65b574e2, 0x44db7cd9e938c89d, 0x304a3116a418ad8d,
+      0xc7a0942f84642d3a, 0xb003133209c8bb7d, 0x09687550f6dc8490, 0x047b321ccebf72d3,
+      0xbcda2e1ab915b1cb, 0xc418b2470cace67c, 0x443d7e0e5e7c1a49, 0x06680765679608a1,
+    },
+    {
+      0xaae1760eab92236c, 0x33221c0ac8e2b948, 0xdf7ad3750af6911e, 0x251c33daa4389dfa,
+      0xd7b7707ddf03a5dc, 0x5a0e8d361daefe34, 0x009faeed5f2f4589, 0x3037646ae3fde614,
+      0xc567b65904626ca3, 0xe0f6bb77a736988c, 0xfcd57a665c204f0a, 0x0c344bc13c805019,
+      0x1a06df3e232e9b9b, 0xf90fd1db38870669, 0x573ea12e3dc70c11, 0x237b63f291c0abfe,
+    },
+  },
+  {
+    {
+      0x7a62e3027fb86d87, 0x174f2339480b73e5, 0x216898be3416030d, 0x275568398c5ae014,
+      0x8f695aa8d53fec70, 0x39930bb8a984e88e, 0xaf580c33b4ee237e, 0x19c3ba02ae36d96f,
+      0x1bc0e392d516c5e0, 0x52de1a45f36b7092, 0xe293259eaae6d9e2, 0x2fb5b857613e3293,
+      0x81b3952340187faf, 0xf48e683a58a32176, 0x2a0a28984cfe6492, 0x2eb233fe17dd418d,
+    },
+    {
+      0x63210e92ed1b0b53, 0x47bedfe2d59db4bd, 0xfc16fef32b23a365, 0x1354b294fe206833,
+      0x4e9b5f4e3f67e49b, 0xa42ee0b9d9f20b2c, 0x9985d9009f52bf26, 0x169b8dd754635681,
+      0x7dac9c6627aaa27f, 0x9fad1bb817704081, 0x564f5e3002f63f1e, 0x290f763255c5756e,
+      0x0c849926693fe111, 0xad5078152edb012a, 0xf8a56a6f9c836b9b, 0x0f7dacbc9259813e,
+    },
+    {
+      0x7823297d42118308, 0xe31e2b1b1d4880d3, 0x95b7d396a09785dd, 0x1180c9ad117f1e85,
+      0x10117614e7fc7bc7, 0x26ba38cb91d49270, 0x227225351e72fdaf, 0x2bc49216b04e91e9,
+      0xe40a89c86df14bd2, 0xa30e44a2af7f0948, 0xdf2cb873f2d3f577, 0x089213af8495cb6d,
+      0x8e970e8d2cbaa31a, 0x87cb018771260782, 0x39232775c901a0c0, 0x1fb81f4391fdc1cd,
+    },
+    {
+      0x0a860b075490a269, 0x8aea21f59bbe71e0, 0x6b0c47203f7e75c5, 0x04ea9df3c99dbb11,
+      0x5224c5bbfdbd9de7, 0x8bf90819deeca161, 0xd1e21703fb558055, 0x0409ba03f3add3e9,
+      0x5311ff5fd97c9be7, 0xd892dc7ed120729d, 0x338d26270599610f, 0x170651f02e8cc640,
+      0xcc77be1859707f0b, 0xceb7b652392b8d4b, 0x7695e143ecf1adb4, 0x1e549bc2c4dd947c,
+    },
+    {
+      0xfdd540b937a23b1f, 0x41fc1bb9f950215a, 0xa4296b78e9a98b05, 0x29e8a6b46cf4db9e,
+      0xdead04e981979740, 0xfaaa250be92f0b11, 0xaa79051817610378, 0x2ff3b0bc55d31416,
+      0x30d54fecca9e41f6, 0x36f84d2310911c4a, 0x1b3f7531a81f7803, 0x1717cb58834fd1d5,
+      0x44424d068510a547, 0xf9ad10b130c74921, 0x36ba346c5f2c72de, 0x2fad2aa5409f9ed5,
+    },
+    {
+      0x9500fae23549a74b, 0x4f7cc46bd0dc44b7, 0x268a8ce17b8fda04, 0x2aa204f66d4033bf,
+      0x68c5c463bc060c07, 0x4d525d7f4b9790cb, 0x368cbc4fd0a39580, 0x28415a18c6993bc1,
+      0xcf98fd44dbefff9e, 0xf3861733274df792, 0xc7d0147c96263abf, 0x2ba585c203c64183,
+      0x8f23ed325fa31bfc, 0x72d3fe82a91b4212, 0x733ff8db6e58d5a1, 0x0e8084663989a35a,
+    },
+    {
+      0x41dbc4163ec422e7, 0x3014a35c53403f2f, 0xe2bb5908879001ab, 0x21de36dc44a211d9,
+      0x0cc5d05c94f5e6f8, 0x64fb565f295e3a50, 0xf24c5f360f4d685c, 0x26e68a99864ba019,
+      0x9793ff45856e25b5, 0x9874d78ddca63e83, 0x17f1811bbf787afb, 0x0814f06655967776,
+      0x50c01b2a69e8ce3e, 0xb7e5c5f724765f28, 0xfe94685b6f1c711d, 0x29ef0a4d2d8e2268,
+    },
+    {
+      0x609920674c002aa9, 0x780c2b0b5a64224d, 0x5fb04f321aa24cba, 0x1fa0c4b9dba575f5,
+      0x20a0e7fb92702626, 0x8ae2a8793ab83eba, 0x76c0a6c1c89f1d71, 0x05db8581e71f9877,
+      0xd9394818bbc67846, 0x5a79b7f1e9df2b5d, 0x2160d93ea08fefd3, 0x13c58401df87dd9d,
+      0x3ae1cdfae0547a4c, 0x4b2e67f3b3408dd6, 0x4f0dbd9837006928, 0x1f132693a7c4679c,
+    },
+  },
+  {
+    {
+      0xf4fd51885cac31a1, 0xab26633a972bfbba, 0x8cb8dcb08017ea62, 0x274c85f905a58321,
+      0xe55f62c5d85a48c7, 0x2c79bf3b0739d275, 0xe4c60480b268a831, 0x270a8d3eba8d527f,
+      0x12c5e981022e7d07, 0x5d1ee5b3282e4b50, 0xe28edfe7258b7c62, 0x01f6fb54d8e21beb,
+      0x15ae8532da39584b, 0x8113c37838874ab1, 0x6e95d34e0d6b3f30, 0x2650103f109c3d45,
+    },
+    {
+      0x0a9d968ae7921b6a, 0xc475ffac3d6fe928, 0xedcdc112e7324a72, 0x131eed2e19d6f2dd,
+      0xe1141be854f1910a, 0xd97fdffe1a89bfb1, 0x3fe93b90a5ad4d36, 0x0705b6c886ce1d61,
+      0x2a0b79ab8a07a21d, 0xb3474b3892f74207, 0x11042c93d6e2e936, 0x1c748ede27f18c88,
+      0xe8af0dd573c0efb1, 0x51327af925053636, 0x540e6fcb43e06658, 0x14b994f736526296,
+    },
+    {
+      0x41d3bf4645806d3a, 0xec7cb503a08c87f1, 0x1f21e67294c4c8e7, 0x0c314ddd705edcc8,
+      0x025d3a6270ff2acf, 0x3b9b0e5cfd6b6503, 0x48305f23074e33ce, 0x1accc6f0a13316f0,
+      0xd6d10122a20c2984, 0xf6edc76937529631, 0x3f0d975b98c2a3f2, 0x248ef349bbc73199,
+      0x5292f218666bec74, 0x4f7306ca87bbe407, 0xda7ab73ae1c2a43c, 0x08a05b1f77d36bc2,
+    },
+    {
+      0xfc57e70e2ede3973, 0xc51eb87286a7de92, 0x14b2e46a3f7012b5, 0x0ddbc0404ffb0fc2,
+      0x241f7c4afa281b3b, 0xb26a0e2954c39ab9, 0x136e817babeceee5, 0x008479345c81616b,
+      0xab89af468e037aae, 0xa5e44c489c79444d, 0xdeeb7f6717af867b, 0x2c52739036e8ee7a,
+      0x0f044af0c2731c24, 0xdca489ecbd682aba, 0xbe151f95f42dd91e, 0x28c20ba7273abb25,
+    },
+    {
+      0x387631172de309fe, 0x4cfca9dd0b627d51, 0xd97ca5d0378b63e1, 0x04be792cb653aeb0,
+      0x7fadbb7e56d07ab2, 0x3418a57dcc186ee0, 0x06a2d31aaf0c0d09, 0x23fd2cebe7fc3443,
+      0xb1471cc6404ffec8, 0x4c18ac9c7ab1648c, 0x77d4533a8d28f24b, 0x040b4951d664ac71,
+      0x45bc0704dd58ab57, 0x87eccd4453ac4378, 0x66aa741caf2e43a3, 0x01b33772db72b92b,
+    },
+    {
+      0x8449d3edbc0a8e89, 0xa3d6d6317de7f886, 0x1f9931fc2c2bbaf4, 0x2a2b60e29583d9bc,
+      0x6118c4c6629010b5, 0xa336e5edb172e30a, 0x6eb7c319533621b4, 0x21fb0c67272fd09e,
+      0x04d6e70a65e59598, 0xbdbf499b2564e935, 0x3b66a78ef98f4ed3, 0x2013002568ca0a9d,
+      0x90f85f42762a79df, 0xd0de3240b7c490c8, 0x4ab678b62bd54ce5, 0x07299117f0180c92,
+    },
+    {
+      0xbc807f8f1f88fba5, 0xf3c945d4167bf119, 0x3d4136cc58396102, 0x0ab9e50c3947f6a1,
+      0xdfd842b7cf096f25, 0x0c5bf8fc8d52acb1, 0x7b69aea34404c79e, 0x0850cf02dd7d3ea1,
+      0xa41fb796b178e2a4, 0xc3b0431cd287c872, 0x485968028cf43a74, 0x14a475221858994f,
+      0x1aaaafd288366ab0, 0x72108c3e93d8af91, 0x6c38c95763d72853, 0x0721b80e8b2190b5,
+    },
+    {
+      0xd389d7563a73f23f, 0xfa2b16dcd454448e, 0x3cce2f7910c7e7f8, 0x190d04452b385a87,
+      0xca35a033503d581f, 0xe04160827ad5baa6, 0xa55d7d2f2c1200a3, 0x00aca3c4c5bbe083,
+      0x7e15f9b66d76a5d8, 0xd6e3d93ca7689d14, 0x4d537b6aba11c594, 0x0174688423286dfb,
+      0xfa6b7cc17a057adc, 0x4a6cf17a81d25aeb, 0x5fb36936aaf11185, 0x0a65dfe38da5ee7e,
+    },
+  },
+  {
+    {
+      0xbdf8be367be9277e, 0x34eabd3a51a8ec7a, 0x2d469625064eb9d0, 0x23a3be9df24ba2b2,
+      0xf3667ec8042ee032, 0xa0848bc3ae328254, 0x6bf368b69afeb417, 0x2b3bea13f6b48d81,
+      0x113a7060d4a4a811, 0x508c188908e30550, 0xb8b80cb31f7cc6df, 0x2f40e6b2155091c6,
+      0x7f9f7e72e6a15966, 0xba0fc94a45d024da, 0x6479d2bd1e949f6f, 0x1ffac76ceffbb857,
+    },
+    {
+      0xa81203b74ee038a7, 0xf640d33dba65a6d0, 0x05bff8a5f553dd3a, 0x271623057ab9a07d,
+      0xea963c79c3bf44d9, 0x2dc2d871f6f9ec49, 0x32e2010eec50f1df, 0x10ad5524c29ce049,
+      0xd0d128de855cd79b, 0x247eedc65901c964, 0x46d61796c3c0411e, 0x17c6f15fa785be73,
+      0x293c52fd33f4ee1b, 0x3eb1e41ce0906e85, 0x3283b630ccdf8071, 0x2d6f9edb93cc14c3,
+    },
+    {
+      0x4fa4c7d9fcad7804, 0x42d6dabe751b1254, 0x31a07c77cae3437c, 0x0886936c34aad33b,
+      0xbde7afe110ced98d, 0x7b76ac803914916f, 0x687ed44c0befd478, 0x1dc3b82467e288b7,
+      0xa3fce0844ca781e7, 0x2d5197ab88725e1d, 0x6190c35f64b1e5b1, 0x24726b8623dbace2,
+      0x27a784a8ba0c8e22, 0xaea3e63d1c04c14f, 0x016618d09f565130, 0x224915b46abb9976,
+    },
+    {
+      0xda81a032a8e84d72, 0xe20d0eb12eea97d2, 0x97c0f663f4e740b9, 0x14ac8de8e9e610de,
+      0x45fba7270b761e12, 0x5ca6f5395fc3d1d9, 0x5a52ba2fcf8ad44a, 0x1490172f0c9641b4,
+      0xa66c290a38c8fe46, 0x0d56e1c97735c5ad, 0x3e832686ad98cc48, 0x05ffbfd653571742,
+      0x9f45f771794ef8c9, 0x9319ef71b45b2383, 0x35446d56d29578af, 0x11d8527b7f7f579d,
+    },
+    {
+      0xe115ea2548e07a51, 0xf1c0af905d56258d, 0x2ea0911ff953897c, 0x2577c4d870107966,
+      0xf45a4cc4adb93eb3, 0xbdabb42df15eec47, 0x3016ae89294fb60a, 0x0d8f64185b2098ec,
+      0x31036caeb5e55896, 0xd50cf0eaf1346a58, 0x3e6e00ee623823ec, 0x0b9bd5e23cfb63d3,
+      0x2fcaf298fc02611b, 0xab022ea13da295af, 0x9575f4a0dcf6b4f8, 0x05f31d2ad748e8ae,
+    },
+    {
+      0x8e4815914d4ae214, 0x4c4025ed4a610aa1, 0x9069537d46d27cb8, 0x22d1425f68e371b4,
+      0xb5d103988eb5dd27, 0x7141ca2f5d2e2110, 0xe0ab195a164c7f09, 0x2e024f357c3001f7,
+      0x48938193865f81bf, 0x373bf612c7bca856, 0x2a3908f24d4d521a, 0x1d0a1ecf7d24ae78,
+      0x7da6bcf10dbe16d5, 0x271b86d03c4a845d, 0xffc20b2943f1d3d6, 0x26a27fa7217cffd9,
+    },
+    {
+      0x04d4157e39401e9e, 0xa268be615951376c, 0x6b31e01361a4925b, 0x28bbe6b7b883ae9f,
+      0x0cfe8c545f41adbd, 0x1cddb8d7004e111b, 0x9c10935dbb3ea3a0, 0x1f80a77e5ca401ff,
+      0xbcbcf38eb52d467b, 0x2ce24e743b375d41, 0xf064bbc033929bae, 0x2363128bf42ad183,
+      0xe248ac35e3ab2169, 0x3b2fa2bd7cde9b06, 0x35adbd791898d37a, 0x25eed2d534564755,
+    },
+    {
+      0xbf4a301e03b11aaa, 0xb28e5f0efb37f762, 0xbd9936daba840b2a, 0x23849516386df946,
+      0xde28638bc004a4ca, 0xacdfa317824637e4, 0xee62065eb0870bd6, 0x05b6a66d3d3bd69a,
+      0xffd9e40255b2663b, 0x4fc03e5540dabc25, 0x936e00c47280fd7a, 0x0ace69368c957fb8,
+      0x8061c5d4d8ccb27e, 0x136a5912a98c4dfe, 0x02f3ba5705b03c88, 0x28e5af8ad76938a0,
+    },
+  },
+  {
+    {
+      0xd7557bba29bcc1f9, 0x522d5b38619934b9, 0xd7224c852757e102, 0x01063ace8fe9a6a7,
+      0xf3df93dc63d5c61c, 0xeb16a2df6bb48e6d, 0x437d124c5a64f7f6, 0x2b7f18a68b9ad2e2,
+      0x73ca6c233ee181fe, 0x3151944cd2447f6e, 0x5ad21c6ee70cd6f7, 0x2047c209df4bab0b,
+      0x422ea67d5b06bf09, 0x60207fbe9eb6ea09, 0xd14706229f65baf4, 0x2c34ca30da3a60f4,
+    },
+    {
+      0x054eb6cc0bb74b7f, 0xa6a6a4e567d02970, 0x3d8b57ef9e5b0697, 0x11ea02a853832840,
+      0xcf3bac798bd184f3, 0xb5423e3a025c91b2, 0x5559105301146002, 0x0596e4b0ccff0532,
+      0x4cdf5f8483800a93, 0xe10e180a05820607, 0x89733ed324acc970, 0x228e7922e70a5cc6,
+      0xc767384357f6f4fd, 0x0246ea5d8a3db181, 0x35be03b97d764da4, 0x0fb19185ef3b4f53,
+    },
+    {
+      0x535b1b755ec49edf, 0x104cb9c81a7dda7c, 0x7f76c4314ceddec2, 0x2e53adad9319761c,
+      0x5107377af92a09cb, 0x7050022fdcc6b8e4, 0x9759148ef9f82d14, 0x2d31ee9e9795d1f9,
+      0x4dc6f433d9e58454, 0x95a7cebbc420edf4, 0xaaa23254c61fa9ed, 0x1b8690ab89c50cc2,
+      0xbd61800d3698ef53, 0x53ac4d414f2328a6, 0x44f29c181a393259, 0x15ae62dc37e290c8,
+    },
+    {
+      0x9899aeadc30da56e, 0x308d415e89811215, 0xe0e5c14580de37aa, 0x2060be6d53ab8299,
+      0x899aafad2aeaef8a, 0xb7533e53cb50f998, 0x0542a37c1b9270b9, 0x176970789f6045ee,
+      0x6676a5fcca738f93, 0xc2b591eb5bf1dc8f, 0x548b75487b3ffde8, 0x1907fb5ee4003b88,
+      0xdc8b05ced09e236c, 0xef45c60b98b66c19, 0x2a16589f2e58be37, 0x08fead4966eb8317,
+    },
+    {
+      0xc9735e506d2c5d06, 0xc47fb6c74ab77964, 0x7ff75cae01ea987c, 0x0bf35b59e733594c,
+      0x40f856cc445bffe4, 0xf9d426f13dfac7b3, 0x3e8f144734102331, 0x1652bd7a601b5195,
+      0x5b3f9834906ca843, 0x8972cefe1dbf8ea9, 0xcd0f7f936e7ce1a5, 0x2837bda520d28bda,
+      0xc68136a7f22a740d, 0xabc32ec5b46c2046, 0x65489f2216698824, 0x086303d7837a795a,
+    },
+    {
+      0x809e904285a96f4c, 0xa466894c9cbeeb53, 0x03468d89cc122c8c, 0x2cb2666486ca2a3c,
+      0xc4d32bbd68f9e41d, 0x785cc03b745c25e5, 0xf2b08733832a5dfa, 0x1fadb6776443d6e1,
+      0xaecfa6131f20a7d0, 0xef576a5fa3a2fee5, 0xda1f98d89d0a6e32, 0x2430a9851cd3813f,
+      0xabb6fc45e2e8988d, 0x40ebae761d4f0b60, 0xeabaaa40e5ead8c0, 0x0c5c8c25058f1366,
+    },
+    {
+      0x8e013140e6e48287, 0x6e1991f7b2d84f88, 0x933450e633760dce, 0x03ec20c3cc1f32cc,
+      0x965752a946b1d237, 0xfc2aefd55b4872f9, 0x62950e7dd0fe0e17, 0x159966f847bfa119,
+      0x11160399ce73494a, 0x92fb5bc544acf825, 0xe223242f53c42dd8, 0x0d3776271287f4ca,
+      0x792b84091207847e, 0x359141af7429a9bf, 0xbad6976f433bfe74, 0x0d36315194af6563,
+    },
+    {
+      0x2507bbb8d43b671e, 0xb87885c92872cecc, 0x709df616a7040793, 0x15a42c775b63e5c0,
+      0x0d8b4b76ebc23e97, 0x1fb9faace347b1f9, 0x5f8e2a7c767cf9a1, 0x1af815f158e2ccee,
+      0x9ecc6f3a39b56ee9, 0x25ea2cd6b90e1934, 0x478429895a4d2aea, 0x19e6a289a94635cf,
+      0x5884de4c0cb35d4c, 0x85242b2b1afead81, 0xa49bc3ed16cc212d, 0x13ed79136baf29f5,
+    },
+  },
+  {
+    {
+      0x320176087893bf47, 0x1f76cbb18f8701e2, 0xcb5eec4594623124, 0x000a185a7e07ce3b,
+      0x19cbc8ac96a04274, 0x534a918ead83fba0, 0x5914af537f9b77d0, 0x03197478e10e99f8,
+      0x7c9a9e231931cc43, 0x0b6f772626bceb98, 0x6ac892d027e6c734, 0x0808f83b725fc1df,
+      0x775a76d5ddb35d60, 0x422255818ea35c2e, 0xabdf3337cf21bfb5, 0x003b495b0c05034b,
+    },
+    {
+      0x542ab4983af25426, 0x48cf728392d6bfe3, 0xc6c00ef4ca18786e, 0x0b0ecc7564f9c978,
+      0x69f0e74460e53a54, 0xc3371f67abf934b7, 0x1ba8fbb4a8fcf1f4, 0x19ac102fc6a204d9,
+      0xd531b71d84c30bd2, 0xee089825768eddab, 0x3fae3a7d3ae1ca97, 0x1a154ce23a06a24c,
+      0x1cbf85137c728bee, 0x62af990c87923d5d, 0x0884ffb9aebd09de, 0x21a66d2121b1a0a7,
+    },
+    {
+      0x031b2d78dc384891, 0x0421cf06181a8e27, 0x82af2264a175b47b, 0x0b15277ef5c34fd9,
+      0xe010a5619abc4e68, 0x2a71d13c5ef80f07, 0xc4b49ee78194d382, 0x13c4749f93d1fb6a,
+      0x721a82c26face5c0, 0x7e4989ddd80f68d3, 0x02f82305b816fb08, 0x15bb91ae073dfbef,
+      0x5235135aba1b929f, 0xfbcde86be987a48e, 0xd42a78b184200219, 0x27e055620c8bcf17,
+    },
+    {
+      0x697aa6b936abdc6f, 0xf7e2e8dd51f90491, 0xa9f226c663b8f7bf, 0x0616b8c09776aa4f,
+      0x880a6ff9cb7a0390, 0x972ee865ff02f9bc, 0x6b255d93add92add, 0x0d23cf89b9e16b15,
+      0x079e46e2d956e9fe, 0x6c0844e1f42fb5a8, 0x99ec3cb8acdeab68, 0x3030d8129f3a8c43,
+      0x68019dec8d72624a, 0x0b1920682e40c05e, 0x8b66c76ae33287e4, 0x2dc0c5dc37b6c723,
+    },
+    {
+      0xd02be1ff8ee0d7cc, 0x8b4d7e90be9e76c3, 0x873685fed6e9f622, 0x24d3c20e6382a8d2,
+      0x62f40510fb5be36b, 0x9eaf2432b21ef59d, 0x6709f88641eb2ae4, 0x130af044a38263d1,
+      0x0c516735866d5136, 0x546b88df53db553b, 0xdd7045860f913729, 0x14f8d7ab86efca0e,
+      0xae12aa92a3d8d8a9, 0x0b264fe910eb3026, 0xb4f4266ca620ec42, 0x1f342a4572d789ef,
+    },
+    {
+      0xb8ae8d77cf720f9c, 0x624822998781d0fb, 0xd8b22ed7ce385019, 0x28c396b23aae4571,
+      0xd88bea302916a09a, 0x91cceca81811759d, 0x5775761989a7674b, 0x1064975f5c603710,
+      0xe0e8c1dd43f1ab0a, 0xd5e671ef9095e5cf, 0x1b6606b02ea1d21c, 0x06445c07fdd98b24,
+      0x7b6f81d3f3e5419f, 0x5903b620042dcd03, 0x95c25fb69ee3372f, 0x09f2b45fb3a29fa6,
+    },
+    {
+      0xa737c8c48c8d2162, 0xc519d357d1b6cb57, 0x92a6048d3ee00946, 0x09e54682bb1d1f60,
+      0xd96b2be9a3e73aba, 0xe3bc88a8850be3a2, 0x51ce43c00d033872, 0x20499a67c2d848d9,
+      0xf50f8eeda4c78eee, 0xaac9a8a7f06e2f39, 0x98d423bd68565688, 0x0e3adc54f15ff4a7,
+      0x9ecce57503fce631, 0x0e1358ac11fc06f5, 0x925dd50b6d8ffa59, 0x1965ea95d7d393fd,
+    },
+    {
+      0x0a5519605cb670d5, 0x4c697e456dc0d9c2, 0x2a2e41bb8e214f0e, 0x0071bc53192881a3,
+      0x1d805fe8684905ca, 0x321fd0ff62fd1285, 0x55b651e44835de00, 0x25188db51dc5d194,
+      0x766fd78874ffadd1, 0x3652d9dc25c67f80, 0x5d326425b1e73183, 0x17fd651ebab18e4f,
+      0xef46d2790c09b57c, 0x450bc2ea52756c1a, 0x54c57cc1886b1b29, 0x277e2c526baa21cf,
+    },
+  },
+  {
+    {
+      0xbac9218eb1a403a3, 0x6bcd32f8c7fb7b28, 0xf43916318da0027b, 0x0b20b5a98a386c34,
+      0x5d0b3f59ad7406cb, 0x691b589f7b08a81c, 0x3eb85b77050c9c31, 0x2f72d2768cc1ad0d,
+      0xa4e8d54495ada372, 0xd37afae52050fba5, 0x4c550153b67a4e71, 0x2a0907a04b9d4352,
+      0x77b020c021e987be, 0xa79a32416546b943, 0xc6507592e7ad0dab, 0x0124aae278aeb18c,
+    },
+    {
+      0xfd0dfbd6f4b84271, 0x4ad6993aba492e1c, 0xf1c846bc68dc609e, 0x09ec5f4dc544dd1d,
+      0x1db99d366bdffc68, 0x5a2d140935b4a8dc, 0xf6ca5a7b8daeade9, 0x02e33a5aee051618,
+      0x9b21285c3898fefc, 0x71103865df16d7c9, 0xabf68db57e6d6933, 0x18f68561f5d7d928,
+      0x6fcc8c930bc391d1, 0xf928a90f25181838, 0x055461334d24dc80, 0x14ae9ec19eafcadf,
+    },
+    {
+      0xcb85af2daa3c7759, 0x69e727cae42f7133, 0x75c5e5d933055e1a, 0x172f70970467fee8,
+      0xcce3eb7fe8be8661, 0x0f5db4daeea09222, 0x7bc838ce6c68510d, 0x2cac92ee08087392,
+      0x8d4f5f5272f8eff4, 0x69d36bc085dfc658, 0x08e8023b87d902c4, 0x165bc9a0c158816a,
+      0x8011099897f50cd1, 0x5c37a9dade240e71, 0x0e39d06c66403b05, 0x0ca7df16997a18fe,
+    },
+    {
+      0x17eaaa78bc032aa8, 0x3c52e84ee77d6c6e, 0xf665c9e7b77b1b95, 0x2ad08f5d3890a5d8,
+      0x5487c2a33b5880e8, 0xf9ce546c8ff203a3, 0x40890d540812755c, 0x158194357738f2cb,
+      0x7bc5f602e8211b5b, 0xae0e4863bd2b6c92, 0x851844b9ea735bf8, 0x06fce83074b527de,
+      0x0598eafa2174ca8e, 0xfaa8ebdf33a5ddf9, 0xc2a4c55ced1f7d37, 0x01309540f4a0a90e,
+    },
+    {
+      0xe72d86b83f1886bf, 0x965eab14753cac80, 0x6c2bd8e0c86f1274, 0x0c2c162a104cd0e8,
+      0x3a30173af9e15a9c, 0x7ee9ae74b024b089, 0xeb81374b3dbe252c, 0x1424443409efd7b3,
+      0x28b6f0619f711748, 0x04141fb9d857a475, 0xf5b190afe51aa763, 0x259190208f1b07d4,
+      0x9b644345e4578943, 0xb26b2e937757f247, 0xaa0d572085963db1, 0x1a50eca8b2fe1b68,
+    },
+    {
+      0x096a570d73fc7905, 0xb6218815e1bc0563, 0x2bd4c3ecbc9a1cf2, 0x1777059e451c95ce,
+      0xb824002d607955cc, 0x5322dea7c60ba145, 0x274ec8670806d880, 0x10fad25b7a72ae85,
+      0xb8dfbe1f943f95e9, 0xb3ce193a847d0a7e, 0xdc481cd44f56ea2b, 0x29ed7ba39e94a9bf,
+      0x66b0fe828616a30a, 0xde35b2e4b62272ea, 0xf1652f425098f418, 0x0246fd0630db554b,
+    },
+    {
+      0x2838ec56da3b7e71, 0x09094afb699a4b37, 0x67df6aac7a22c203, 0x25c1e4194794c44d,
+      0x8209d1e221fe234e, 0x8a5e2266857028df, 0xff0816977eb1570b, 0x2b0891da3e3d6321,
+      0x68723c0c9b36cc51, 0x10720baa90a32ca2, 0x67c0118787195a97, 0x2feb4fa4eab6ee61,
+      0x66d9b675fd01e971, 0xcd52c53120f3d391, 0x1b334bebbba73a7c, 0x1ac55f91d80742c9,
+    },
+    {
+      0x7da0eb54a6f1a9a5, 0x2f7bdfd2cb97cc29, 0x0963d497a5b3e4f2, 0x28a99e536f3b2d7c,
+      0xa22183b998e29424, 0xebcb8cc52e75be39, 0xd1c13277ff8b4269, 0x0a14edf93618b14e,
+      0x8d5cbc53a595ccd1, 0xe5e52c671ff5f0cb, 0x27a3ed96d14b6626, 0x0d2e4266bb301a92,
+      0xb733765be6595a53, 0x8302280f6287239e, 0xc9fafb5ad50b3ff1, 0x133adde22792894a,
+    },
+  },
+  {
+    {
+      0xcf23f7eb2e5874ff, 0xbfedb406610d53b4, 0x3291f332dbd5faf0, 0x2c0542c8515cbca8,
+      0x17befa046228863b, 0x6a80938ceb3040b2, 0xe29ba7f12c98bd5c, 0x1c5492f6cc9caf63,
+      0xdff525be9340dfdf, 0x7612039930c67565, 0x802c3e99dea2d62c, 0x22951574e27d939f,
+      0x9b84cd1e844baa6b, 0x94ad6b6e5e2278a4, 0x8278344d9b5b418e, 0x2cb4abaad38cf0a0,
+    },
+    {
+      0x827843f1cc6ac6eb, 0x12146a168f8beb5e, 0x7dd4e4c37b1e5c18, 0x303a8c658d84aa0b,
+      0x16324584c20d3e4e, 0xf3d7aeec0466ea0f, 0xa68d0f33af5ade37, 0x0dc2679ecd3babf9,
+      0x592e834509f07149, 0x81914f80aab618f1, 0x1be3bf7cf563f823, 0x14a6ab1c6f95bef4,
+      0x0c48771defaab7e7, 0xdabc874dc38af98c, 0x0f8cc6fdc71b49c1, 0x08ecf433acd9c94e,
+    },
+    {
+      0x77c314a1e3a232f9, 0x12b6d6d19e2fb3f4, 0xb7fee1e4f81b1291, 0x1eb59014d5834218,
+      0x76f534602f0d956b, 0x15d9f383664ec96f, 0x925063a8b22c85dc, 0x2aaa35c03ba4e69e,
+      0x7c337205c5f66745, 0xd519e09575c21cbe, 0xa44e23d324ebe2c7, 0x1db408464c117c42,
+      0x2227196e298fbe76, 0xd997010d08e2196d, 0x02d53f329b6374b2, 0x0daf34a8f672d44e,
+    },
+    {
+      0x86a6bb171d645397, 0xcc44168d65582b6f, 0x000f055104fa6eed, 0x0e78bb4ead39b537,
+      0x8a209cebc7590fa4, 0x8cfd402d58adcd65, 0xf19753d9013af65f, 0x0a571233ab251aad,
+      0x876cfaed149bac59, 0x986feba185bdd4ae, 0x5d11861089e2b430, 0x1d020cfb09f3964f,
+      0x8bd49ba4c6ef661c, 0x40437a2c332b2e50, 0x02e04d3e576076bc, 0x05992ab26cd52c0f,
+    },
+    {
+      0xf8421f7a6a3aef7c, 0x121604c2f9037fae, 0x62c64fa9c7d18f41, 0x22b50e474011e552,
+      0x8029b28019a6b3fd, 0xf298119f62d3ba7c, 0x64a2dff99c6f25cb, 0x240e17bb4a168487,
+      0x90b056899e05cc8a, 0x42b687991f838c5b, 0x24094039f98e9b11, 0x0f95acdc452ade8c,
+      0x0ca44c3fa2e4ab1b, 0xf044c77c00993e1d, 0x54c119b2da6c6150, 0x268896ef6bfc227c,
+    },
+    {
+      0x689f4f3acf7c1155, 0xcffbbf36a464ffdf, 0xb8f889221a3ffe7d, 0x2aceb61bcbd0e246,
+      0xb524ac714c031c56, 0x740590bf680f60cd, 0x8192685dd3f9521c, 0x0c35fe06da4847ae,
+      0x1ca8166615c284a2, 0xeb825ffeeaa102e4, 0x3c201851afd44937, 0x1ced756ab494b5f5,
+      0xcdf10ee2b94872a0, 0x9a97f5d9737307f4, 0x7eceb4119db45d6b, 0x0f4c28c9d4d1285a,
+    },
+    {
+      0x347f10a54f0690d9, 0x7d66747dc14b2431, 0x908e6d3928ca25ea, 0x197515cbd12a7d33,
+      0x92460f7834798fc9, 0x252ee2cad9f768e5, 0x95b0feac8903884d, 0x29d676aaf04dda33,
+      0x9bf762600b88ae2d, 0x927c35de098bac12, 0xc05f0f1494ff8106, 0x2892288e93f0a312,
+      0x1248b21b972a1ae6, 0xc0b50aed815e8ff4, 0xb4af9e86dd770ab0, 0x21f318d21e665fd2,
+    },
+    {
+      0x1b9276ceb59c4a74, 0xe7aa4ed48835deea, 0x8402f944886de3ff, 0x1f14c8aaadc80c1b,
+      0xef02cf01aa05a148, 0xa3a440a51f6cf1c4, 0x6e9d894884078b46, 0x146980963a9f3c2b,
+      0xa4463574137c2302, 0x17459415caa729ed, 0x1f452d6bbdbbd22a, 0x0b9d15834e09baf1,
+      0x108f73c8e83e617c, 0x33cc854b4b427e99, 0x75092a2e227f551b, 0x1d1c7a555b0ca6b5,
+    },
+  },
+  {
+    {
+      0xa60eee46c2a61473, 0x6486c66a874c2f98, 0xb1d06d3cbe965354, 0x2e172e1f46e43d07,
+      0x59f2fbf90ce13ae3, 0x2591767b22b7e7ca, 0x7eaffe95d23654f8, 0x1d4c93c10b5b11ac,
+      0x0ae457c1df2c965f, 0x3034b9768b8fdbfb, 0xd7962648cf1b5f32, 0x0a3c5b862bbb92cb,
+      0xd8faeb099ee4076a, 0x4d2079475af2f1ab, 0xf16c7d8cd3bc0c1b, 0x279cfacb466c11c2,
+    },
+    {
+      0xe0f1351aeff408f7, 0x5f0ab843ef74782c, 0x8932a2d7a43082d6, 0x2249b18e603bd5e4,
+      0xba36bf58ba6e0890, 0x916e270a00e6ed5e, 0x3e44dac2624dbf34, 0x2bba39c0dd56cb14,
+      0x0eb1952c0bb25689, 0x43cb54a6e45f528e, 0xbc938f316362f70f, 0x19c0704aae397209,
+      0x19a0b69dcd42008a, 0x2c5fddf854221b9a, 0xd6c0fbf26fcf366e, 0x03c5274ca1f04def,
+    },
+    {
+      0xb19e8d46356abfd3, 0xf09e143f6feb8eac, 0x222712d77194f157, 0x1ab261b6d446dae0,
+      0xd47aa90365b8a0dc, 0x33d57d369b1aa750, 0x664d229efc097011, 0x2031791519b09a4a,
+      0x76ae3f47bb2499f0, 0xe8870f6e985d5fc1, 0xdc1e13de15ba14cc, 0x1eadb1945bc5f441,
+      0xba6cedc917dd87d6, 0xa2b80d4248b6febf, 0x2166335153e93a67, 0x2d76e00b6b053126,
+    },
+    {
+      0xb8d6a8f6bb6f07c1, 0xd805da1b75430a3f, 0xb39d5da443e32027, 0x2cb97993d82efa8d,
+      0xab658cef1fae0403, 0xc98551d2f3cb64a5, 0xdf123f9be4b41ebe, 0x27ce5cd4c1af3ff5,
+      0x0433d8162f420f12, 0xd20e202f0f02a610, 0xb560782b8b1d10a6, 0x1e51871d8e2cde07,
+      0xd9420c469b7abb3e, 0x8582861c9b7466e3, 0xb985512639585c07, 0x1b70147063611a6b,
+    },
+    {
+      0xce69bbcfcecc7c77, 0xf55c8316f16b2d7e, 0x6b4fa0647517cfe9, 0x10f22833b36b8a05,
+      0xd3c784d38a9dc22a, 0x909b2bde82b24658, 0x6f5d0f0de2540ec1, 0x0f60acfdc73427f7,
+      0x9adfb1f947e06744, 0xf11db3a9afc8c592, 0x9b9db0fb6d6dc5b9, 0x011292941f988031,
+      0x53320871700fd35c, 0xf394a4efa6d5aad3, 0xd4e24f107c414942, 0x132f7f5652e9fb2d,
+    },
+    {
+      0x677123a3efd904b9, 0xdd0256a2ca9dde32, 0x5212ae07dd94dde5, 0x0d080df04e17fd06,
+      0x3bd2d28e7fd96dbe, 0x6a9b9acec43409f6, 0xc261bd01a7db512c, 0x26197a84c4c4217e,
+      0x66fed080a48a16cd, 0x8b6f9a48d794eaf9, 0x8414123c336161f9, 0x1bc76b4e4f5c4a29,
+      0x214c58f31a924163, 0x3681667c4a15172c, 0xed2c86ffdfaf3952, 0x297b1f8a20a02a30,
+    },
+    {
+      0x36d0ab6a3713b63c, 0x79a97c29f4bf38af, 0x0b9ec77f5a80d448, 0x2a0bc4b992dd3e0a,
+      0xd836ec9672b63c3f, 0xcb8102a2c7949c5f, 0x731f3aa58e20293e, 0x2adcb6f851720c77,
+      0x22882289f27bb46f, 0x95bf0856e5c4ba6d, 0xf58a8dd2303a7ed9, 0x00336c9e32f5e920,
+      0x4ceed206c6d1d2bf, 0x2d696ebd0b9aa213, 0x0f5dee5d5469678a, 0x2ddbe0a320e6298a,
+    },
+    {
+      0x049caa66290475c7, 0xd845839d71bea442, 0x12facff6a99ebda5, 0x27018a1feddccaa7,
+      0xa37d261648fbb7a0, 0x17d9427197aa82bc, 0xb0b9ca711d1761a2, 0x0dff6e129d8099df,
+      0xb472c88e0d583141, 0x687d0fb9229119c4, 0xc87ccd8e00491385, 0x0f244699ea68286a,
+      0xa3f281099822933a, 0xc6218bd1e032db71, 0xd6c8aca08a42ddca, 0x2740395733b59075,
+    },
+  },
+  {
+    {
+      0x98babbf26aa02391, 0x108e15dbbebb3386, 0x3035728df15fcfe6, 0x2f4837857ab13def,
+      0x093886db48ab1626, 0xa8ae77f053f9d16e, 0x2bf78fe2671144a0, 0x06d25cd9f5f2ccb9,
+      0xcad10d68cb1d06c2, 0x6d9fbb23ac045d86, 0x1a0c5973426b3c4e, 0x18f1cfaddf906f43,
+      0xda93b9aea5af3e0d, 0x407911ca93214e8d, 0xba1aec5bd2dd3f72, 0x2ab0fbfeb895e00f,
+    },
+    {
+      0x4a3452033f57a65c, 0x12b874acac41092c, 0xc6fbf566c8a1bec0, 0x0aef6dc63cf309bd,
+      0x79e8ce2be71bab4c, 0x782d90672b189401, 0xbf5c354517230cd2, 0x2b92709cb0b7150c,
+      0x3f8a123a7ab6ac86, 0x4d3f913ceb1fac50, 0x6921a7215779ff60, 0x2ec2b3b7e90d9d83,
+      0x2bf78984ad459fdf, 0xadd1ebfe609b9137, 0x1bd90a75161fee37, 0x03cfa72fdb440814,
+    },
+    {
+      0xbe9ac3328d060780, 0xef1bcdee581e8616, 0xfc34d50e12f773eb, 0x1c6fa9504c9eeab4,
+      0x73ff46726b12933f, 0xcdbf1b4ed44d79c4, 0xadc084c2f89ff768, 0x23d3ab2e6c5c6919,
+      0x54854f7d574d7bf7, 0xf316d4697ea6e85c, 0x24e46d0068649a5f, 0x186786e218970a39,
+      0x089f03b7ed51a1ff, 0x69d4e3eb53105527, 0x36fab00288c7f75a, 0x1510e5b4979e946b,
+    },
+    {
+      0x3510b88f44af887b, 0x8bb1c0f4ecd1637d, 0x21506005926397d0, 0x0357bb39be995841,
+      0xca6955343b15d8fe, 0xd917f4b77ceb9f5c, 0x9e3a89567cf2a155, 0x2bfcab98ba42cf1f,
+      0xff28d5e6bcc3bbbd, 0x2530b5cb41d467d6, 0xd36807fb69af976f, 0x1429386aa9789160,
+      0x4f416bb020167926, 0x39a7b2996eb32da1, 0x29a16253a1d7297c, 0x2b4fc53c72fa88c1,
+    },
+    {
+      0x7c5a5c190e4b33a0, 0x64f924f5cc58ff3c, 0x018ea52f40f222a1, 0x1da4883d5dc6e132,
+      0x42b3c6b671a523c7, 0xd2c0a9f2e59ec687, 0x4d569c6d1055bb5f, 0x157a2cc1a79a9225,
+      0xcba819001d807de5, 0x69c27f922552d1c1, 0x43c2a05ab7595439, 0x21e27b7a7c4513cb,
+      0x952060f025cd825f, 0xf5949df859cca28f, 0x1841cc7dc8f311eb, 0x2c0e5cf82081405b,
+    },
+    {
+      0xf4596e0661a9df79, 0x8721fb866989294e, 0x0ce0cd9904966378, 0x006f95aa68eaf930,
+      0x9f6814a20d5c420c, 0xe604c38e51958f13, 0x3655b7184d77ab18, 0x14f2ce8835da47f3,
+      0x189dca3bc0e10d9c, 0xd269e9cb738c18dc, 0x83f15a1543db0f55, 0x00949353230aa15a,
+      0x63107d408137ffbc, 0xb41623e0ae46aa41, 0xc225422076dc7acc, 0x0e36fad45c9aaea2,
+    },
+    {
+      0xfa3772e92331d317, 0x8e5b7664d5bae5bd, 0x73aee08350f1de74, 0x186430063f440d20,
+      0xb6d04064e1198bd6, 0x14371e8656e652f6, 0x45c7aaa0dbe51cba, 0x1f6c74172a10e5cf,
+      0x6bc5bc640dd17fec, 0xceadf0ec51f05dc4, 0x48e67de3a14dccdb, 0x20607f33c4b91659,
+      0x87f4338b24fcdf44, 0x39c95eba9f1728a8, 0x8f4062f1f233e7a1, 0x2f51ccbe4ed0fd79,
+    },
+    {
+      0x6de56f6b8eaee4aa, 0x36779b396ecde8a0, 0x1b5de0e73f26af42, 0x0b28e30c00b13d8a,
+      0x5eb79fe1e2ac8477, 0x9c157f45a6c8d2df, 0x34092990ecff555e, 0x11eeec5bc627e58d,
+      0x47ccd0cf4c80475e, 0xc2bafbd7acd4c456, 0xe56096b9e5d28f29, 0x245e8f3d3f79e0c6,
+      0x324aefaf07a9f1e5, 0xa2b3783a73a827b2, 0x6ede550e59c87700, 0x2ad4ef1a96ca778c,
+    },
+  },
+  {
+    {
+      0xef8ae588502b8d4f, 0xa268a4c85ca30bb8, 0xd4f56d3dd8a6bfb3, 0x14e71951c723d8a0,
+      0x21353b8306dcc917, 0xee7de52fc13a55f6, 0x610fd76084f7cce4, 0x269c4a33245cb7cd,
+      0xfc1094e315553ba9, 0x85403ad28f572874, 0xf7961a9a0d3727c5, 0x1596d08f742e4655,
+      0xd9d14e8d4adafae4, 0x8f4fae7efd21bc2b, 0xffd544b46d032dcc, 0x130421501a453755,
+    },
+    {
+      0x24699c33168781f0, 0x25245fe41972da2d, 0xedbfa05b9c72e15c, 0x19464f2c1e33e24c,
+      0x388a8d3d9b7cf690, 0xf35ad937eeaec327, 0xa815fd566702d9be, 0x1cf15c8592792f0c,
+      0xdeee8b144f768e6d, 0xe4a0ae68f818e998, 0x0db4c7da41320680, 0x2f36e570075af064,
+      0x4ff63e42802073b9, 0x82e89041ab25e493, 0xc74d8370098b6670, 0x1457a75cd4fcd00d,
+    },
+    {
+      0xce1699f785db070f, 0x7d7f42180b2b36aa, 0x1de7b9b43ca5f864, 0x1f128e2c5aa2667a,
+      0xf5d93c17b94d2b70, 0x1fd560efe83a9079, 0x6bb855918c3a72c4, 0x23b956cc469e6e89,
+      0xb7a226fa49959319, 0x908eaef2408d62a8, 0x2e66fdc7d077597a, 0x213ffd245406e60a,
+      0x61b3fa3842bba69b, 0x747594079708e3f3, 0x7d64b2c22b614d2c, 0x16fc086ea9b7e56d,
+    },
+    {
+      0xaeda11a5ea32b847, 0xf52874bee02b1e1b, 0x2140107ac44c24f3, 0x0c6fdb52303f6155,
+      0x4fd5ee527d19e1de, 0xf91a1827cc54dda2, 0x2772f610e7c1bd6c, 0x136bcc3b3c223396,
+      0x4f70e91c6852846f, 0x6b7cd987652a22a2, 0x911cd5784484d84f, 0x1617f2d02e86a3a6,
+      0xbe528b37cd3fd106, 0x2ec92ffecaa1376b, 0x3ce4b1f7a048fe9e, 0x134893098466f4d8,
+    },
+    {
+      0x8eec8a8c2bde68f6, 0x5614a89dc2202d0c, 0x1dc638f786ab8af8, 0x045a67b4e3a852ea,
+      0x3d7b707780b5de9a, 0x8a46eae7422ea3c3, 0x132a6a48ff7e77ba, 0x0821278a1c7f523c,
+      0x149e7d803cca3023, 0xa675499c7f0e492a, 0xaeeab5399dc1f60d, 0x0e6cf32712532599,
+      0x17aca86733b2e988, 0xeafc62d41e598544, 0x27cc8eb597ae7526, 0x157b2dc87fca559f,
+    },
+    {
+      0xbd50bd73d736e4ea, 0x2aff65270d1f23c9, 0x0659fb60883eb67d, 0x1dccb7535d3d20f5,
+      0x29d7095e88b52248, 0xd1d2fca2c7bd87ab, 0x617c89b4a7fe6ecb, 0x2e7f07b7e67db899,
+      0xd6a64a9322fa1fde, 0x7edeb80a1c9a639c, 0x5463d80f34ac224c, 0x1dd6a51ca1b30465,
+      0xdd1310c9f4f7850a, 0xaea375eeb219590b, 0x765e35b7ab33c80a, 0x2bcbc5d75c651fe4,
+    },
+    {
+      0xda477555f2b71158, 0x4a8bdf8b6dce14a1, 0xcead93038a091748, 0x0f164623e908cef6,
+      0x76b996ae2b00fcdb, 0xa27b03e53b5fb0f3, 0xe9cfd3eaedf58e3d, 0x0b6cddded9f806ad,
+      0xd0c785995c7e124d, 0x973f12200ce6ba55, 0x78829deb929d29fc, 0x272fd095b7c3f009,
+      0xb6a7b1359b2ac3ba, 0x44009f3c7d3b217c, 0x52d7b756af369f60, 0x220928dac315d77b,
+    },
+    {
+      0xa98f04bfe5438628, 0x9572552387c98fa9, 0x7c7c6eb57e2c2027, 0x29da6c67af52e4ca,
+      0x8acfb930964dbc2d, 0xf001b835f368d6f2, 0xc432b927b642fad8, 0x09d71584fcdce1db,
+      0x25594b29ae878f30, 0x43c55891b2235c2a, 0x4418c0552b22f439, 0x1e7ac5a3b62411b1,
+      0xf74b7caa21883751, 0x57b925955eeaf46f, 0x79adc71122895598, 0x151ee3a94443badd,
+    },
+  },
+  {
+    {
+      0xb1b2d053f284bb49, 0x87d1e43b679b8783, 0xf4e6fc6b3eaefc22, 0x12c3174229fd9d83,
+      0x68128fc71184b314, 0xf51d56c8e2939ebc, 0x4bf279edf46d9fb2, 0x1bfe1c757d5c5140,
+      0x5f193e030c561e7f, 0x4cedbcfb6aca10dd, 0xcede17ad4c9ae584, 0x183e39b1fd55df8f,
+      0x2077d5fca5b11b7b, 0x7e04dbbbd92320ff, 0x0e8c1e3199c10fc6, 0x087eaf676e50df4c,
+    },
+    {
+      0x97d42ec9e6bccc13, 0x191b67f2bffc5056, 0x65589c1b898c3ac5, 0x1e2880c4d4ce122b,
+      0x14a960ec4f1ba523, 0x32588fdd3bd5f301, 0xc2d6cc2a807dbf63, 0x263d918282a49d2e,
+      0xf7d8d6a4c9305095, 0x56b19e60db58bf93, 0x3bb577454d486f0c, 0x0fbfcf5d320896ca,
+      0xee7839cf452d459e, 0xc293c1e3e176c4af, 0xc0887b57a3e14372, 0x287429bd9206fa65,
+    },
+    {
+      0x17094bba197b5d36, 0x3b334c38526a7563, 0x6d96ad7106e694cb, 0x0e4cc54f6e155e88,
+      0xc48f07e5a99e27e3, 0xd9cd57b88138b23c, 0x24393472f76a23c0, 0x2fb27b41c0eb4620,
+      0x88b5e748f3fabaa3, 0x5343bacd6b8dacc1, 0xc539e3c1e4ab34f3, 0x0353a5129f92675a,
+      0xbbf6e99a5ba27480, 0xb9c01ee2a1ddcbaa, 0x81cb20c437c13a14, 0x246758c8811c54f8,
+    },
+    {
+      0x19f29f973798d635, 0xfe5b48af9c8ded84, 0x643058d55f674c93, 0x064d0e3d64cb6ca9,
+      0x629a136e57943e0c, 0xa0cdd1c624673afa, 0x204aaa0b1e47e572, 0x05e401267d5ccbbd,
+      0x5afbb62a95950c01, 0x1ee0f61396d66853, 0x184385b821e818d9, 0x1bca3849eede9cd1,
+      0xdbac3e099a2a30d8, 0xd67c8856c020fc58, 0xa73e663006af1d7e, 0x2b6853ffe6ad81d3,
+    },
+    {
+      0xa6189a585146eb90, 0xf887ff406d6bebda, 0x99d8c1d5b941962a, 0x2685d2722c59b7ed,
+      0xf1d49238da06b0a8, 0xf431633d670caf21, 0x7a99475a8b4b8569, 0x29c1574542c48c96,
+      0x5b6c2fecda279ad6, 0xa7f5064798ac06cc, 0x2c0f6dd2152db591, 0x08c7cda3ab43bfc0,
+      0xd7109eeb6eb93457, 0x949d577158469075, 0xafbfd6374921efe8, 0x27ae91fbc0a9199b,
+    },
+    {
+      0x295afb1ed0924989, 0xbb00d854a2cb581e, 0xad72b144cfb6e10a, 0x04985050b72493d9,
+      0xb3f643916d995600, 0xd03bfa85cbfd26cd, 0xa359016c2646c70b, 0x21feb0a1371c0c44,
+      0xdbe5fc8bc5eca9d5, 0x25d5ba33ce45bbaa, 0x22859896f7e83787, 0x0608851f6c24c40b,
+      0x9a666dd8c496be81, 0xc08e05394489c34a, 0x1de7d9f7117455da, 0x175f6a8e345de2fb,
+    },
+    {
+      0xb827141f1bd68a57, 0xd9ff8c15ea24b5fa, 0x71b0a54402795f72, 0x25ae55c4063daa0c,
+      0xd0dae9b7d49a28d7, 0xf455c0b7b48b1b76, 0xe7d11b274d6a57e4, 0x2249236928e4bbf0,
+      0x758dd1a7613b700b, 0xfb142aa2381a69c3, 0x513b0d390f44d3a5, 0x151fca2ce3d21375,
+      0xca994d30dc78dc40, 0xdf9a79a87f44188a, 0x9a92b46a04e73a1f, 0x26067857fa6b3845,
+    },
+    {
+      0xd7813f768d845d79, 0xaba5df83e025f108, 0xa53a993f34d4e1f8, 0x09fe28dcf11e58cd,
+      0x290fe7c6fae17c60, 0x02b0667fe43c9f0f, 0xe58c8dd2c7c36d44, 0x1961196ef5cb663c,
+      0x6bdb797120330261, 0x32b017d288b79a38, 0xeca125d6103c528b, 0x05bf3405bfdfc5b8,
+      0x1638b32ed26b8bd0, 0x725e6f5c597a304d, 0xac09aa761582d8db, 0x14a73188109750b5,
+    },
+  },
+  {
+    {
+      0x1b4e0284e3f8df67, 0xbff89340e961fad8, 0x1044399291c8f997, 0x11f18fa2d038a3a9,
+      0x0d3fd8b61f0984d0, 0x9945e0de68806c87, 0x4946252bd44b4766, 0x1d5833e3d0a10a25,
+      0x8df7e86210da7c3f, 0x3d986a55e996ab45, 0xac05c4f00514ad4a, 0x1c4d8e90a8c824dc,
+      0xf322ccdf23340478, 0x19702da0e4934008, 0x8f4ad244591adc20, 0x298dee35166acb34,
+    },
+    {
+      0xf7b10334757e8e79, 0x51562f5461d8f0c2, 0x5bbef025bb47711c, 0x27c6c6d5da59ab34,
+      0xe6cb52d49ed8d135, 0x0e6d33b99205c5b3, 0x49f2e55cf5e6d984, 0x19d56003446173c0,
+      0xf1793cb7cbc32dd8, 0xc6460918d4f4bc22, 0xb2f991e3738db102, 0x2c7a419582f44984,
+      0x4c80c40aeafcd287, 0x5594d844c204e0c3, 0xea1dfb20fab5fbe3, 0x01fb412efca480c3,
+    },
+    {
+      0x605bac275e028f52, 0xf7c1e1a9456ce371, 0xfb517b1683a02b81, 0x0dde65762466efe8,
+      0x2873ebff27bc2c1f, 0x865c4875c0641b87, 0xa5af3de2b4cffc2b, 0x2767e5eb9e75a023,
+      0xfd2c88e66625a7ed, 0x1b0c1ed1d127873d, 0xac5473e8935ac272, 0x03964951dbaffe46,
+      0x7e99ea7a99bd428d, 0x07af8592f7652d75, 0x0104e48de5c1629e, 0x01369ccd5127189e,
+    },
+    {
+      0xd2a85b7df277a67a, 0xae81555b6135491c, 0x25656fa80d5a3263, 0x282ece261e25e7df,
+      0x9e62707bedf6f529, 0x6e87a7902bcf37e3, 0x704e78e7e514e114, 0x1ddf6701c71231a1,
+      0x38de6aec0718effa, 0xa385f2b4fcde2ef8, 0x1ca5ebdd0a486480, 0x119688ea7b4e546d,
+      0x9804f1bd5111db7c, 0x68133515ce8115be, 0x5f85fef9c657c386, 0x28309c3e84193ee9,
+    },
+    {
+      0x335df3f7192b2d43, 0xc0a92fe720df8552, 0x1fcb9edffcc468ea, 0x237d7cc08b21fd35,
+      0x6e5bb1b2b807a0b9, 0x27c91d77b954d1a5, 0xeba1bddb2a8301c4, 0x012c49b426da1b65,
+      0x279d7ce943050189, 0x4b8fbb0b7f5e2fd4, 0x6f391e9336c06c07, 0x0504d6e51fd91b64,
+      0xf6ed42a461bd8b6b, 0x48435c98ee23ab17, 0xb0b4be7747a9f30f, 0x17783b159c308ec6,
+    },
+    {
+      0xe0ba57df4bd82a63, 0x13e650fc3a034245, 0xed470a6587548a32, 0x2f5374f5655080b5,
+      0xe080239e1cfb50f2, 0xed4eb006c6108a8d, 0x3052171cacc837aa, 0x00c1b47486890dc5,
+      0x2fc083aab1de1c1b, 0xadaa72112a32e079, 0x5e11e1a304112de0, 0x0558cd9d105e9d6f,
+      0x92cd806f6b6bb277, 0xba7b3d02f6588786, 0x58879ed62b30eaff, 0x171be9633ca151ae,
+    },
+    {
+      0x69fe373db6e0f8c5, 0xc4b48b0af5a21ecd, 0x86bc71b3793cacd9, 0x1c0a2bd5154dcae0,
+      0xc81d6cc101685f14, 0x395671767366ced1, 0x85ef7374594114d7, 0x272d801c45557d58,
+      0x771313dff29bb7ec, 0x6f8ae53a0705f80d, 0xe3859165dd240f6f, 0x125bc5a5a21be473,
+      0xf0cabad9e187c0f8, 0xca01c88320b33af0, 0xd7ee39dfdfb61b9e, 0x02f8da6eb40e6c5a,
+    },
+    {
+      0x471aeab46b6b1ac4, 0x74a0933d6be76d7b, 0xf27c85ab7d4182ee, 0x107819c6790cc08e,
+      0x20a3a9dbd575eaec, 0xcafc06a98e2d4398, 0x4c6bedda3d8223b8, 0x2cf453191e001d43,
+      0xca383fadb22a17ce, 0x7bb79fdd0798891b, 0x3d4b9bf12fe1d7f4, 0x07fb61343eadf74a,
+      0x72075e66e5c3bc60, 0xa87b0626b6526564, 0x5288eac4998d6b54, 0x1efb5c9aef4ba7bf,
+    },
+  },
+  {
+    {
+      0x2a23fffa52557ea3, 0x8b9c8dcb8fa3b97e, 0x2f9dc0b5275fd34c, 0x1104e2770a704ee1,
+      0x780225a5c4db198b, 0x269620b7fb17ed25, 0xb0d49eb0f93b06a9, 0x1683cf3187aa5396,
+      0x0479ee2d1235f648, 0xfeb6af15d6e00086, 0xb27481b383731f93, 0x0a4a4fd7848b25ac,
+      0x9726f9e69bd1a97a, 0x3ed893710ec587de, 0x2e9566da7782c0c0, 0x20a54e312ea44502,
+    },
+    {
+      0x2d7fc8a8dd3d66c9, 0xda4a8f79779ef03a, 0x8fe8b84d106d0d6c, 0x06e0207f0438c275,
+      0xafe538bcc02102fa, 0x3e20a5e1f2f32ff6, 0x9d9f13bb1ddd3b5d, 0x2df9d2211d0fbee8,
+      0x3a688e8a792f961b, 0xc77d37221859729e, 0x0999139f08b2e727, 0x16f0b98353097bb1,
+      0x9cf26959dbd0808a, 0xe7bfc47764ffda89, 0x01f85c92f95c7381, 0x12b26623a57d0c70,
+    },
+    {
+      0xfaff897c99008f73, 0x19a49583ce9771b0, 0xed066b241b95b3c2, 0x14eacaf621eeb316,
+      0x1e25c02eff932548, 0xd8b950cb5a2a821b, 0xc99ac949f0c114ed, 0x241a9d90b24571ed,
+      0x528e5c978094e468, 0xd4ab9e6add072adb, 0x4c43594f1839dfb3, 0x0943aed06ba3b27f,
+      0xe2ac70e59a729077, 0xb17c49c79c32b6df, 0x010a2a82a16fc87e, 0x093fa749ce5c0bd6,
+    },
+    {
+      0xe85eb70155d27821, 0xd56720a0a72ed294, 0x18efaf14f0b1c0ec, 0x2ee6fcc5c5fe007c,
+      0x458bfa1f559ecd21, 0x7083b4908404b53e, 0x155f3b409d1d73b8, 0x2d0f35ae0d6ddb70,
+      0x007105b3f2273e59, 0x2aa837df2a5cd9e1, 0x200470e2fc1b9fa1, 0x27c7e2cef9d3cc80,
+      0x79673c3696ca77cf, 0x9f4e913fd35871ec, 0x27ea9b0fea947d40, 0x1f530abca4e3f91b,
+    },
+    {
+      0xa215fb4609970fb5, 0xbf48e28c0ada419f, 0x04b44d2386295376, 0x131b19185cbf2fbc,
+      0xdc0ed46178454894, 0xdfdb784981d657d0, 0x70dbed44acf31bb9, 0x15c55599dec42732,
+      0x9c26f7ed0837f3ab, 0x770f6d8a80abaa88, 0x3f1d4be1bf436c01, 0x1785cb6eeba6ebf5,
+      0x84e2f9fad2201008, 0xf5a41efe0f295123, 0x26144eba756ec869, 0x2e96ff53b86f2b21,
+    },
+    {
+      0x1dd7b0aa46f6d7fc, 0x461e4ca8bbd159f0, 0xce51cfd49f1fa753, 0x0ee995eef69929c7,
+      0x19399bbf926da078, 0xa3dc4a4b76078681, 0x4e50114525c48e86, 0x0c79b40fd77a26e7,
+      0xe627d54e278b481a, 0xa793dc587c0d2d91, 0xfcf09d7693c35880, 0x03c4a3797fc4875c,
+      0x2a00c83ae2b62ab8, 0xce0d26a465c9540f, 0xb8e8b66da4af85ed, 0x2f614b893a8c33ff,
+    },
+    {
+      0x3ed77450aa00e4b3, 0xc856a40e644242c0, 0xf7daf8f037aec5f0, 0x123a05b613817cf6,
+      0xb6374400f33b8109, 0xb90f5f70bfeb8c0e, 0xe6c2890049eca9e0, 0x22121d699abc4d12,
+      0x4838132d518f5970, 0xa7eeda2c041fa560, 0x6b4d9b5139ef9dd1, 0x22ab4fe1dd345209,
+      0x6a5e176feae5f0f1, 0x753fe33797156e74, 0x53bf64fe7b6c158e, 0x10a8ad5fad8c01f3,
+    },
+    {
+      0x9d206c3f05bdc72a, 0xe20b29505a081083, 0xa8625fb21fb09a93, 0x087bb31ffaf9884c,
+      0x202f1387104bada8, 0x9e8f110a49be66ec, 0xac268e3650b009b3, 0x0ec96416aa7d3eee,
+      0x40a34740485a3974, 0xa5e2842bdc89a558, 0x518b5addebc52b5f, 0x292d933fe666b51a,
+      0xe73fb0790b4f34c7, 0x22ed4749c270ed9b, 0x9afa052638478d2e, 0x0f7814c189d3f4ed,
+    },
+  },
+  {
+    {
+      0x2590912202107de2, 0x21fe5bbb32199769, 0x718e9d81d1bc6df2, 0x035e11d7030851dd,
+      0x2e3ffb7c34ab8618, 0xe356533f611750bd, 0x2ddad6bf69ffd024, 0x0e2766cb6d9e490e,
+      0xfd53be48facb60bf, 0x60f9c8f6dee8a85b, 0x2d726e059d78881d, 0x1a2b08863afa2119,
+      0xe86b0aa7fc387b81, 0xbd01a4eabb533959, 0xe3a88337cc70eedc, 0x27517d29acc8029a,
+    },
+    {
+      0xeef2b03026ab5348, 0x0824fffd623e5936, 0x4217f2b9eeaddb20, 0x1a2b612dfdffd411,
+      0xc7b81e37bb34b0ae, 0xf0e621d308a3834f, 0xd12f30cba7607016, 0x1f693eac48dff84e,
+      0x4855891eb38fe9ec, 0x504888d41150a533, 0x1ca2b7fa7742e219, 0x261cc8c0289baa57,
+      0x6c90b4893ede6bc4, 0x60d6fde6135a5b8b, 0xb5cc4fd6c54d03e0, 0x13ae727b39bdde09,
+    },
+    {
+      0x7d7c2e65f089037a, 0x90fd9ca0fc2c83eb, 0x0573b75adcabe350, 0x2fa1edb3f07bd7aa,
+      0x92c829884db73edc, 0xa279781036c5a2d6, 0x5f1b0a72bd818d60, 0x17575c8d7b063f35,
+      0xb19c42ebb80c19cf, 0xddd97ea15bccf504, 0x73ac1534fc006685, 0x018f4dd724c92b12,
+      0x308c73ece5a5c030, 0xfeee54b1024e20e8, 0x136c684aabf8c20c, 0x237bdedbe48aae89,
+    },
+    {
+      0xc699f64afd0859f2, 0x59fd559c947aeec1, 0xc92abd076075f4d8, 0x2c9c82c24c6dd43b,
+      0x4d56ebabd79fa3a0, 0xefd11b5b05fe54b4, 0xdb7ba35168fe60be, 0x24e49b9b1dab0b0c,
+      0xdf3ba750913f6e99, 0x36f2530f744ad0c1, 0xaa18b57cd35563f3, 0x0bfb857fd8360fc6,
+      0x1568b439ede252a4, 0x1d295f4dbd9f5633, 0x701acbcd92048a56, 0x148e6aa84cd77160,
+    },
+    {
+      0xe3f1e9bdc377d8d2, 0x21bd089d852b4974, 0x4243c03f56aa211b, 0x10d05372dad8098e,
+      0x8d9fe8b8ae45955e, 0x1c225b501e7af6ea, 0x3e96c09271d6cddf, 0x13c4f886d709bf81,
+      0x7a0b90df76964891, 0xc97a56c59926f004, 0x545d43e929f7f2f8, 0x2bcfb12e65b4114c,
+      0x833acfd979905eb0, 0x9764a1e85732bd9c, 0x49306d141f2f7832, 0x1674bb87a7e00f8e,
+    },
+    {
+      0x4d911a7715254fd9, 0x6e305b2b9a5840a2, 0xb4ca94f63470ae4b, 0x06f5d4e02b9c4d95,
+      0x42cb7be1a36b87dd, 0x709acf2abbd00200, 0x0fbc5b3972daadaa, 0x1ffae7a32d322634,
+      0x48edfcb491081fd9, 0x0a7cc08b3a4491d7, 0x15d7c19a8e8c3f6b, 0x2562f531baf22e68,
+      0xb997a7733b00d28b, 0x210ec3612a037ea2, 0xb64176ab0c217805, 0x213afc8bc59ac459,
+    },
+    {
+      0xcbc94f6155afad57, 0x7a7d97828ca91c30, 0x72555da9ea77415d, 0x08b47ff4f44fac6d,
+      0x79ebdbf8c9a4dc8f, 0x173a3d353eead01a, 0x2891b4ef08487325, 0x2f3c474f63fbd3e3,
+      0x0bd78f6bf87c4392, 0xc037d824a60882fb, 0x22d7db3d4dbebf1a, 0x23aaa03a00a32024,
+      0x383f70fa53210bca, 0x151217b695c58f49, 0xe17304c1c47b84ab, 0x0e95823e4718a026,
+    },
+    {
+      0xc31d3c97f9a88eb2, 0xee062f776befcf30, 0xe26338ef307cf907, 0x04810eaefdfa1b01,
+      0x2c668afe60f3ea77, 0xe10adef29422a5a1, 0x54046134e31fcc76, 0x109cbe7e5b035755,
+      0x6e14d2c1bcde556b, 0xb0f57ca2942bbb32, 0x6dd1c3dc828c50c2, 0x167f201c8d83dd46,
+      0x1b37541b45901c4a, 0xdefcf1a290c38159, 0x075ef5e58b0d5dbc, 0x1cfa8908dca12121,
+    },
+  },
+  {
+    {
+      0x8c40b92318338308, 0x0ad8266ae34b3c08, 0xe3f673a2090ef1e5, 0x105dd547f9ea5c00,
+      0x680719f3975ff012, 0x3d65c905d346017a, 0x436bb9cc1fdea4e3, 0x2f1c24e3e3731f29,
+      0x0b826481df6f996b, 0x62011955b27da862, 0x7ae9855bbb1c6e0f, 0x277e52b10b0d2271,
+      0xcf3c80f8afede023, 0x2f74b50772b722b8, 0x3bfa1a32349ca11c, 0x05fe8338ff6b778e,
+    },
+    {
+      0xfec69fc54d341519, 0x7970f03201cfd65b, 0x7dd9d9079357d7fa, 0x10fc73860dc4e2d4,
+      0xb6841e104c7118e2, 0x9bba8fb0f66298f6, 0x6a202660467bcda8, 0x2df4ea933df30d81,
+      0x6bf571b8590925c8, 0x7b066caeaad3c927, 0x9700aeed17f160f4, 0x02c71d7a5bf48141,
+      0x10afac5d50aa6063, 0x7668d8c1434bce09, 0x9c4b1947c0e472bb, 0x26acd99fecdcb2b8,
+    },
+    {
+      0xb84e4d7eca7db628, 0xf44644c4f462d883, 0xeba4e7722d69e11e, 0x0c90dd95d7632688,
+      0x5e70d4547d70ce9d, 0x1f1f7c4a9cce1915, 0x40e9ae2c821cb158, 0x16cd14bd693fbf0c,
+      0x64581645130f9951, 0x6e76fca75bc7f1e3, 0xcb004eb00adeed2c, 0x198573a59bb676f9,
+      0x08ac1b3d0be34208, 0x978840cbf6b3b5f6, 0x2a49cecd80eab569, 0x1d3c0ebbcc5139c6,
+    },
+    {
+      0x0470d710b7de8e64, 0x72fafba36f094586, 0xde34a6eab8a0b2dc, 0x15a4336891fbf62e,
+      0x73c2455bf1d868cf, 0xa8f4498d3f5728cf, 0x6552a3092312d3bc, 0x29327143e5abeb15,
+      0xecc5ed7d5e39568a, 0x9763ee27b6966528, 0x53a6f235aebb72ed, 0x05bc8d120a008275,
+      0xaa6caaef19c080a9, 0xee7a3f2617b1233a, 0x2cba043a7427f98d, 0x21c4dfccab31f68c,
+    },
+    {
+      0x9a3dbe9e5910b196, 0x749457afc944db09, 0xc3c421180a2174bf, 0x205ff8ce52f2a15f,
+      0x184b3ae042d4d5db, 0xc1aa7593231ad318, 0x0c1f67a390ae0d44, 0x1d3816a2d4c19ce8,
+      0x88fdb0eb9eabe7a0, 0x2c3299077750aeff, 0xd1968fa994d4f359, 0x0e74ebc117da6d95,
+      0x7e0b9458837e5ecb, 0xb0fab037001fefcc, 0xc7c353e400626f8b, 0x24943b043ecfa34c,
+    },
+    {
+      0x8e79351afb2c058b, 0x5d5566f115d5115b, 0xc55a869b29195b60, 0x231e57fce7ba3f9b,
+      0x8278535d08a1cd87, 0xd2a907e60e1b7dc8, 0xfebacb3a1fe8616c, 0x1f6da5f57f396f69,
+      0xa4deb79a4f19eb43, 0x027ad8db414c4291, 0xe5fd581a5935e157, 0x2314a0c6ca014252,
+      0x09c628b9f9eb64cc, 0xd8bbb387d691bf22, 0xd0e8380307675ed5, 0x0ee7c6170590c36f,
+    },
+    {
+      0x4e4ee5e6c35a0fdb, 0x2a6aac6f3bed8b37, 0x1b0e954612c3a0e5, 0x0c67b26cda339604,
+      0xf172694c5d1c7ab2, 0x11ee95ac04429495, 0x4fcd89d4789d5568, 0x2f743105af412f18,
+      0xd42d1bc72096ec29, 0x0369327380deb6f8, 0x3ee3728264c2654a, 0x2f94abc5b9aa9244,
+      0xa5634be61ce7df62, 0x868bd0d315867417, 0xbcf7a1a3b30b3b98, 0x16a09a0eacf7f66d,
+    },
+    {
+      0xb6a55720b2fff5ee, 0x6ee353f492448aca, 0xecc31fbde2822127, 0x24d5567800b50264,
+      0xb7a007a0e8f5ac83, 0xaacf48010bdc2d03, 0xa91ef0a66f70a5a3, 0x17d6ad36e4f046ce,
+      0x8491a6655f6d3960, 0xba124629206b936c, 0x0f840ebc9aca5399, 0x0a30f8f137338143,
+      0x2176e0ed150165f6, 0x5402289e2e2c74a0, 0xfd207b6622dbecd8, 0x0450ba9d186314bd,
+    },
+  },
+  {
+    {
+      0x2862bb4c8254de00, 0xffa1d87d0405008c, 0xe46a48d7a9c9b46a, 0x2d3030dfc6261119,
+      0x93dfc33101d85586, 0x1103fd0bc83b5a11, 0x996d0baec65d8805, 0x30591c37f9b09104,
+      0xa8f2be9ede930c50, 0xd19eaf3bd16811d8, 0x45d98ac3f7a7aab4, 0x04512dad9a2d02f2,
+      0x30246f9ec6ac1009, 0x2fcf2df9d95e949b, 0x574be166c38795df, 0x2fb8024ee0151dbe,
+    },
+    {
+      0xd584f4aa435ee4b3, 0xad184b6787b00c5a, 0x932bc21e43f614bf, 0x1f8e7d3f0140e764,
+      0x6ae811b5dd446f92, 0x1aa1d0191b680808, 0x53b4c24be29e708e, 0x2d8023426969cc0c,
+      0x7c9c53b8feaed3c9, 0xe5010d04c8660714, 0x3378830568565a45, 0x2ccbd413097f3271,
+      0x26f462e5d94c0dfa, 0xd7af1e1a8ef26724, 0x962fa82c391b8bf4, 0x130c0a8dcd588cd5,
+    },
+    {
+      0x38ee4b8c8c968d22, 0x877f57732286802c, 0x785078a427d55817, 0x040c5921fd251af8,
+      0x72ca5bd83316866a, 0x8ffec7493b5f3cc1, 0x29572223e8313d73, 0x128bf7b01e765662,
+      0xa7a634267e252f5b, 0x9783efa5ba2d8d7f, 0xd17e8c387c43a704, 0x04651d7868831855,
+      0xb21a248c47434f77, 0xf7d5c5070f17e78a, 0xcd0fffdf310e938f, 0x1d7d41fb8b309d9a,
+    },
+    {
+      0x52628eca53aed087, 0xbecc308503b50098, 0x6d1820bb18b3c4ff, 0x147ce858ca91fb6a,
+      0x24851e5c7a852760, 0x9584f2a3badd420b, 0x5b5f354e138f7a8c, 0x122de80b0c225463,
+      0x623d9b51eed28ad0, 0x59105939b63ace43, 0xd9408c0eeccb6681, 0x068c1d8f0358870e,
+      0x44c4d2ab2d35a03b, 0x73dcf26be871eb2e, 0x54a9f122504408c3, 0x10f2d19ab4e1c1d2,
+    },
+    {
+      0x771a5004bc911c1b, 0x1f3d9c1345270adb, 0x12cdcca5d7ab2032, 0x302e1e90807ce2a1,
+      0xab68f57cfed64dad, 0xdbff8a83751f1114, 0x3973b49cdafa7954, 0x0909f89f6eebae4e,
+      0x298429cde29c2d30, 0xa0d060bada956869, 0x823c450710461f49, 0x0e04fc1c0eb827b4,
+      0x3654f8d55923fbfd, 0x048c53aa3d3c6489, 0x35abea303a7d9f7b, 0x2e7b49d1ab9e516c,
+    },
+    {
+      0x54d3ab4144e551cc, 0x33e555dbd30c1e02, 0x842972ca9a8da9c3, 0x213544021fd18293,
+      0xe0f5ef18bf34e8b0, 0x0275bc98bbddd9cc, 0x1700cbe540b71858, 0x1871b03cf4e196ef,
+      0x8c4c40542df45349, 0x27d2fe199afaf52c, 0xa1e45b3ff41a7886, 0x0a3bab0e9f3fa659,
+      0x90874e0706690636, 0x9e645bb0f049827d, 0x662e008c925093cf, 0x0c749fa5f4fb3872,
+    },
+    {
+      0x63cd820fa4a1adfc, 0x3ad62183ffe72324, 0xcc80c817043067c6, 0x2ae3dcc907a85fa9,
+      0x453def6a9f29e088, 0x1bc53031b5caeaa8, 0x2aec488af5018f0f, 0x0bbb9fc4c1281d25,
+      0xf698002f56d4a91b, 0xed2a16260fd4e331, 0x3f78e3ff0d4d34a2, 0x0d9af5ca4ebcdbc5,
+      0x8ddc9d3a864548e0, 0x8df64a9d4124e9ca, 0xceb9842222407713, 0x1d68e7847d3c58e3,
+    },
+    {
+      0xac3628ed313eecfd, 0xd4bcd5ebf600255b, 0x8af850a4f3cfb422, 0x2d06986bafd80195,
+      0x520569d57ff6c8ec, 0xda2d288ff79419f5, 0x5f52e021243eb508, 0x0edb1245322cb5f0,
+      0x579d38dc0f54f773, 0x793ff58bdf3ead22, 0x822853a56deb2f35, 0x2bee75b495b62d8e,
+      0x1cc7a274a7b7f5d2, 0x163aeffbb60c973f, 0xf3cf9d90abe1524b, 0x2f20b9db2f639806,
+    },
+  },
+  {
+    {
+      0x3e28ad10b75dc9fc, 0x2a158749ce64e5f5, 0x51fb37fe34837ecb, 0x1e56d3562c085196,
+      0xeaf8aa768ad27196, 0x94f20cc644aa94b4, 0x9d820f2741404434, 0x13c35ebaba56fc50,
+      0xbeb1ee8b33665ff5, 0x2a6b4dfc81df3b66, 0xae58e84ebb4ca7cb, 0x1903c4261fac6b48,
+      0x7827876698daa952, 0x85f43378cf453e7c, 0x3f10e5635937e510, 0x2718bd22c20687fa,
+    },
+    {
+      0x70773a33f8bfbfc2, 0x1e13e5f6a485537b, 0x1d2a8e8f4fd9ee59, 0x26e1dd7fbcaefd62,
+      0x4cd38aa98991d701, 0xbe5d98086cb045f0, 0x319ed6d3f1223b9a, 0x05260f20f4a221ed,
+      0xb9cc3d132818d3f4, 0x871097b0ad62f34d, 0x575f2e0804a1e1b2, 0x0c8a4631b8d6e808,
+      0x74a57412c21016b8, 0xa1aa7512c48d0605, 0x9a2ca65c203902d9, 0x0379a339c6f8f7e5,
+    },
+    {
+      0x65868e9f4a08d468, 0x26336c3ba7b5855e, 0x2da1ef8cbb206969, 0x13e9eead163bb3d1,
+      0xa2ce4fc06bc9149e, 0xf803fca8436b6e97, 0xfa7880a20426141c, 0x00a795df5966f8cf,
+      0x755c812a7b70a42b, 0x9d6856d970e1e9cf, 0x5a091849c4110bcd, 0x10c908a83fba52be,
+      0x542e8a6924a9e74a, 0x1de2efc92b852b7c, 0x09fed0f05f621e19, 0x28709db6e2bc9846,
+    },
+    {
+      0x28e855a25142a7d9, 0x4c64549bfae6058d, 0x73beef5fa08e57ba, 0x1fa91f0bfdd7a542,
+      0x7f7a021aa8d450b0, 0x7aa58b85a0e002d1, 0x94242d1530f411c9, 0x27a9f9b898270b6c,
+      0x99700940911b1677, 0xf78b1a49cb77e713, 0x0e3549a2400152e1, 0x1e2d598abac07686,
+      0x9472caa8cdb66cac, 0x83714090bfa22b0b, 0xd700bc82e4002b40, 0x1f30fd1a183f70eb,
+    },
+    {
+      0x30fa150d05876597, 0xc43f6a9cd3735d0b, 0x72b2e8576feac5d7, 0x21df17e0702bcaac,
+      0xa6087fec10236f61, 0x922f5e83ba047734, 0xeb5c248df85853d7, 0x29405a0ce35f6ef5,
+      0x7f08a611aec7333a, 0x9ac409357c8a7ff0, 0x4529725f9f71745e, 0x01c353e356fa81ee,
+      0xc9f406367c8b81c8, 0xc64c835f58cf1754, 0xe430d012b707e0e7, 0x1bca1ee448f66f42,
+    },
+    {
+      0x6cf9c7d33d90c655, 0x19cb03a5ce452f4a, 0x591e88253c8067f4, 0x0c5ea5d50e3875af,
+      0x55bd96046e1a4d28, 0xa0ac59db5de8e856, 0xc020a7118f557cf5, 0x0b8ded09218e290d,
+      0xc60d196a8356e346, 0xd2b60219e2258adc, 0xf9b3dc3c486baf8a, 0x053846328b47bb99,
+      0x795d7ad71141b15e, 0x77124d8efbf54c1a, 0xbc6951c467d657bc, 0x282cd388f2421273,
+    },
+    {
+      0x07121513ebe19184, 0x71eb6a7eadfc71ec, 0x8836948cef3f5e4d, 0x1870fa6b9597f0a5,
+      0xb6e1e17352dce5e8, 0x21cca5cdb4c0e540, 0x6332818f7f25b6ff, 0x01245ed1c8b8a059,
+      0xad4d0b6cd4df08b4, 0x675cde0e04ad6d85, 0x612c51924b259aa2, 0x285f20720b95b39d,
+      0xcb070aeba8dce9f9, 0xe46cc7c1268963fd, 0xc7fe47cbaf5553eb, 0x03bcec07e78c9337,
+    },
+    {
+      0x3c11d9af348a250a, 0xed078436941cc05b, 0x53f1eb6aa4b4c62c, 0x00c085d4d38801b2,
+      0x2bea39b4d40ada20, 0x96ae84868c47f899, 0xa4a3595cbc8a31bc, 0x06484066f3a7894f,
+      0x7c3d5634a28dc15c, 0xc160628ac57fca29, 0x6df0d41deca6a18d, 0x1b16a7ed7b15e54a,
+      0x1a8fa451d8671a64, 0x6ae23364e6519626, 0xfbc58732eda28732, 0x2295f06ce0e3a43e,
+    },
+  },
+  {
+    {
+      0xffdbf1f7e7b1dee1, 0x390209f38cd1073b, 0xd44ea8ab8f4af996, 0x08ad0d2d588154f1,
+      0xe02785fe2dd5ca21, 0xfbf1d02fd2b64d05, 0x905477ad55e7c896, 0x020e75b7bf2c462f,
+      0xc636e71bb670698a, 0xdb8dbbb621254eb6, 0x8666a7035d4ec54f, 0x09a430b4176c76ab,
+      0x3b75e44f75767b52, 0x56fb01778be5a5d7, 0xd67140e147ee891b, 0x04ac04d85b844d51,
+    },
+    {
+      0xad4c4b8decc48e7a, 0x03b677e4c4362207, 0x851c2607d92d3e8b, 0x29eefd9cd00bc06b,
+      0x3a48a466a1976e84, 0x0bb8f38d5eafec17, 0x867529d2ad00df77, 0x24c9664fd9ff6425,
+      0xf16d2325e20a439d, 0xbc6a954c0e7be789, 0xee4f96da4e146033, 0x1979b407580b4f2e,
+      0x8c9ab9f2893871ff, 0xc0e2271be90b797a, 0x2e1e544354b0d9cc, 0x023674fb43c946eb,
+    },
+    {
+      0xb2b803b83b8c121d, 0x54281c535bf37fcc, 0xf331dba366036afb, 0x150f072b6ca1201d,
+      0x891eba1c30ed28b1, 0x2be48e17e66bf8e7, 0x2d7658bc95810f10, 0x1c2c0d49f0bcb9a4,
+      0x3e62d6218b47ff01, 0x84cf5c52e6922b4e, 0xdba82058ca28f75a, 0x14d3065e737a9f03,
+      0x758690e9f1bcc81b, 0x3be2f38c29c04630, 0x0f8b89e49413d9e7, 0x1aed17e4bef10607,
+    },
+    {
+      0x1b7ceee29dc214e5, 0xa845ae6e672f8dfc, 0xcaa9fa661717ec22, 0x2a12390164ce4e38,
+      0x52c07998ab6bf115, 0x18196997d22f5999, 0xc8d2683defb8cb8c, 0x1711b399d82ac66c,
+      0xe7ee31b03d841557, 0x81052d8bd330eace, 0x223ab5f6c1628374, 0x29c60d589f836a20,
+      0xaef8fa66578bd8ee, 0x4d0fb04d408aff58, 0xad3b4ec3134c5816, 0x084e155e38ee2fb9,
+    },
+    {
+      0xae878676e7b756a4, 0x368e1a74420e2b79, 0x9f9fa87d3ae499c3, 0x29740797d526eb55,
+      0xe4686bc82fb8fb84, 0xa03131205e525ac3, 0x2efc7558d4740a04, 0x296f6324ada4ac76,
+      0x6f41fa4335a11498, 0x7b58ef292c511f85, 0xa5261a73d25702e1, 0x2b01d8b2a2a99957,
+      0xb4383da1abb7b908, 0xd3867ce654ab9cd3, 0x93f22a0959483fe2, 0x10d79181e24e97f0,
+    },
+    {
+      0xba4c91caeb72a7ae, 0x2e26f15f25c974dc, 0x330675c3c0696579, 0x1647a57b1fa3b890,
+      0xabd238e7947a0e91, 0xbbf31000b1b3a955, 0x84d183ef2c1a9c8b, 0x0dde83500a58ae11,
+      0x922fd33b7f2b9ba8, 0xf55596c70937b7f8, 0xa9639a45e2f22db6, 0x057fa5b21bbf296d,
+      0xefd8eead52b0dd6f, 0xfa0b409b36f7887c, 0xb21d78a3e06e3675, 0x2cfbdee4e0a65f02,
+    },
+    {
+      0x9f1e6456b6f41210, 0xdf5036c621b0d7fb, 0x0257cd8f86da2387, 0x2ac42497b82044f9,
+      0x649c4e656126e891, 0x7c57de2068d99c0a, 0x9f0673c85574a308, 0x209e4f4993b24c2f,
+      0x81610bbf60dd4c2b, 0x3e5fb1490eb0236f, 0xd01f6e3cff890c5c, 0x1a99e507c4b9114c,
+      0x7d40f5229323254d, 0x9119c266d51995ac, 0x22d5c7c674ce6f2d, 0x035851fa215655b0,
+    },
+    {
+      0xa43ab8235627c12f, 0xfbbee85559a3eb42, 0x78e222e45740ee90, 0x16dbe280508b5aa1,
+      0x7feeb6867cadbe19, 0x89988525f4583efd, 0x03aa191f399d0b01, 0x1402b5edcc0f4227,
+      0x19799b188e8f1b86, 0x5350e18d777e5d07, 0xa232dd5fecf496e3, 0x030ec1087a7873f7,
+      0x643c69fd531785bc, 0xb3f13039aba07a89, 0x982225405b77009d, 0x2fa344730d12b7c1,
+    },
+  },
+  {
+    {
+      0x10829ca36479853d, 0xce51b6b68bd93388, 0xdd6c327dfeebbdf0, 0x2d692c29762d726c,
+      0xca366782dd12a44b, 0x4c0794b6b3557fa3, 0x8828426dee75e621, 0x0f2ecc081b36a668,
+      0xf31f48a5cd09679e, 0xcb773df012fe2c68, 0xc999e03e64f601f0, 0x2ed23d9bc72c41da,
+      0xc7687632cfdd571b, 0x8039bf03b89972a1, 0x6a71443b8d678dfe, 0x12dbec6267c4c7c2,
+    },
+    {
+      0x9a4d0efc5f33834f, 0xda43a4c733c68ecf, 0x8181e53c8f278feb, 0x07ddb58506e9ece8,
+      0x8e824b034aca067a, 0x552f0b3caedfbaaf, 0xe86cc70e10973c00, 0x2e137736a2b0ce39,
+      0x095b24225ec53a95, 0xfcb69650fbb1412b, 0x3261a33c1fc68ebc, 0x16a2333d643c08e2,
+      0xd4a25aff5c29d779, 0x3bcac97ce7b4c431, 0xc2c194b3b223c79b, 0x1ada9c626fde5631,
+    },
+    {
+      0xa2a6920f0aa9d9c1, 0xf60d800d2861dd32, 0x880e23d360733762, 0x1872c588b107b1cd,
+      0x4fa2899fe0944a25, 0x77765779221bc06f, 0xf96ad523e578d3ea, 0x1cafc1aa19cfff3c,
+      0x9b7df436d5c54134, 0xcaaeb9d16d76c855, 0x1dbc00933ab71f77, 0x00fcbebf5a21a634,
+      0xb69d6c594a46c0bf, 0x7c55e16392d3c06c, 0xf7e10aca22e65b25, 0x0a983ef44d25c919,
+    },
+    {
+      0x9b841fef9efbf4e7, 0x4223c7b3ffe03e56, 0x074e6e9766fdc34a, 0x1f3f4e382b5da045,
+      0x14f258cf9e577af0, 0xd839c3c37c5ff194, 0x12c2af25dac9e393, 0x120f5ef0091627ca,
+      0x1c5dab74220d1088, 0x14a73d5293fd6117, 0xc48ec909faaf5d65, 0x10d66a4fc75697e5,
+      0x4387acadab5f344d, 0x3991be4224934018, 0xef670cdf0853508a, 0x0c065c62c1808d52,
+    },
+    {
+      0xaab5760e44edf43a, 0x59b50c6621f14dcd, 0x7ce0677ec2d26a7a, 0x013b7e443934524a,
+      0x5adffac4ee9c270d, 0x20b1d18be98eb11f, 0x405b1b9cf3a42ca0, 0x02733c1d89b928f4,
+      0x1e3cb9abea3ec320, 0x6c51d786efeddc41, 0x629c74db4880a1ec, 0x2020db1b155e3662,
+      0x393f725f87c19c2d, 0xf8e78a3c08a34d88, 0x63e463e8a78cc357, 0x088fb5b507be3437,
+    },
+    {
+      0xbb08eb6dbe2aaa57, 0xe8a404e5434c4ec5, 0x6ec804f3c3bc5a2b, 0x28a7c052a373e925,
+      0x4e9b4d00854dbfd8, 0x7cb81f49ebedeece, 0x80e113c847577116, 0x2159b13240615e69,
+      0x91367f7228d1a660, 0xf5f58a41a69fe3ac, 0xc0273dd62c0fff61, 0x29dee8c42f10bc88,
+      0x32ec47c78ae4fab1, 0xe76ba798f7c88d52, 0x75f1ebc289ae1910, 0x0433304f331815c1,
+    },
+    {
+      0xb5db13e39d5c754c, 0x675c489563c53f28, 0xa38494a98ce69be4, 0x1aa39c9d3a138a98,
+      0x7d0d5690976fe4e3, 0xc1fdfe6af420224e, 0x5148151a73595062, 0x1c6b27e258cfafc9,
+      0x6239eeb5e1450866, 0xdb33f33c94bc7e93, 0xe0eb85f09378d566, 0x07e06207a7b7d036,
+      0x915cabc23196bb0e, 0x4f9b501bd7165191, 0x3af35ae4fcdbb99a, 0x2425b28c5573a9e3,
+    },
+    {
+      0xbaf7668138547833, 0xe2b6d03177027b20, 0x9768faf77fe1995e, 0x0e8a450704e17257,
+      0x4850494e8bd2861b, 0xeedb6778798f53f1, 0x8cee47a6f689caa3, 0x1a060fa7fce7951e,
+      0x51120524fb4b67fa, 0x8f2544f3085ab25f, 0x61ed077a9d6742c1, 0x15419eeb859e40f7,
+      0x43b5ad46555b30ae, 0xcb2b435f0a589297, 0x7b90f94f200bbcde, 0x094aed019abf3dc5,
+    },
+  },
+  {
+    {
+      0x69c78876e3661735, 0xaf2f38d2cd2e6b28, 0xc0ccddf14e496389, 0x077737a0f3646bd9,
+      0x4537c749dadcbf80, 0x9ead0105f1d34ec5, 0xe48f99866b4ee025, 0x1cb1d2a81b919a86,
+      0xfb48c23cf7b4d4c2, 0x76c0fb6570073b54, 0xb0da4055683de4aa, 0x045d17bf06443757,
+      0x207292c78eabd4ac, 0x024087e355cfa1ce, 0xc33af554c30a5d57, 0x2a51561696d0722d,
+    },
+    {
+      0xbf0dcaef84a94d26, 0x5e44d2361ff04e79, 0x487631ad1c234b0e, 0x22b0c68357e5fe43,
+      0x1a0c1d117382bcf6, 0x556b8d62291543ec, 0x4f7eeed24aca3f89, 0x1f905932e89cd17c,
+      0x402875933c89f525, 0x2c870671b3bf3e2c, 0xa8f2283a6c4713d3, 0x2509be63cbf10f28,
+      0xd942cbf7599d68d7, 0x99b59732f57ac315, 0x28ddff4905d24ca2, 0x2095d6e26f065c5c,
+    },
+    {
+      0xfb2c83bfafe54e62, 0xa65c58a673b0a7f2, 0xab7e6c0294bde9da, 0x203a9693aa4dd8e9,
+      0x383beb39e4def067, 0xb94049cce397c744, 0x22132fc684e66bb8, 0x0a1df642812b8d08,
+      0xe2db39e1aa6695c2, 0x97019cb950dcb139, 0xb0379123f9bb8d5e, 0x1af21cf854e24b55,
+      0xf7d86acc5023011d, 0x7082934bb3fefce4, 0x99f00fb0d3fcc811, 0x304d523711b7b72f,
+    },
+    {
+      0x889576cbb0c65961, 0x2da06c90c8e41e7e, 0x67aaf787a8c8912c, 0x120c5fecf961573e,
+      0xc4c32b33eb5c1da0, 0x93a1e84a1255ceef, 0xa2dd40cb60abe970, 0x16aa12fdd3d8a795,
+      0x0860d97e93e77a5e, 0x4f325dc596f6c585, 0x55d6c4798237d3d9, 0x1e2837925f947a2b,
+      0x7f42daf897cbec74, 0x4eac8a84c247748e, 0xfec88926ae9aa48e, 0x2df866949186d144,
+    },
+    {
+      0x0be1a7806c0d68a1, 0xda347f40ebb15479, 0xb414c7299dd32b8e, 0x2b982bdff50c252d,
+      0xa8b727b1c4d22e2a, 0x2ea6991a0c649758, 0x47f392f69e0f5eda, 0x116039ab760991b5,
+      0x0d38cfd9aef1abd4, 0xb4b45c12e97883d1, 0x17ab9bc6a516a754, 0x2586677a3c120c1b,
+      0xbce0398eac28b8de, 0xaebd035bcf33a4e5, 0x075a20ad2d698b8a, 0x0e7b5980157e27ac,
+    },
+    {
+      0x8ad0e8addec482ec, 0x6bdac73366e67da8, 0x7d243e76c53e8a99, 0x03a52691e95e679d,
+      0x5e5725bf902a2e94, 0x7db96b15c5a60381, 0xddeb621c356f872b, 0x1df565aef2d650a1,
+      0x1f50b81164193779, 0x4f5b90e9818c4233, 0xbbf5a46373b15f1b, 0x0ef6648395c5b4ff,
+      0xefc8d81e7852adf4, 0xd68600fc4e9f9809, 0x7f4fb5b729a25100, 0x0fd1e82883a5d650,
+    },
+    {
+      0x23ba5f13d33d6ba7, 0x9528aeebeec63cf9, 0x24e747d35ff72d32, 0x2f5689256936c28a,
+      0xc94d5d1aa2d61b10, 0x60ac1aabe1ef86a5, 0xbb88b77a7f0efa8a, 0x1907e04df2cd7770,
+      0x3721295b3177e468, 0x1b6097967387d555, 0x0b015c7899a42c7a, 0x19e37f98d7f68093,
+      0xfbd7d75144f9420e, 0xda2feaee69e770f7, 0x33021b36a5fef034, 0x139eaa805a6629bd,
+    },
+    {
+      0x0e003aacb4edf1fa, 0x7f638295cb6e3ab6, 0xe75b325e0debe1a6, 0x187588bbc3879998,
+      0x12601ca62b6cad69, 0x7aa5ac5c83401f69, 0x83e81e61888af3fe, 0x12c8678f270bcc7e,
+      0x00cdcdf8919b8a98, 0xe920d03ccf1402c3, 0xa852d402a39472ab, 0x120b49fde8396162,
+      0x0f2f2b7d69463a3e, 0xa6c01598c128f320, 0x9d65b91628fd0a26, 0x02be7327d8d9e2e0,
+    },
+  },
+  {
+    {
+      0x289e5053615a89b8, 0xf3e90ba8a306e117, 0xc0fb3b214696835c, 0x2248771a0cc0cdf8,
+      0x81976029c9471f81, 0x7f2c9d046f0b10e5, 0x1806281a79ee695e, 0x1cd28080b6fe953c,
+      0x4564bac64f46323e, 0xa8298aa00c3939af, 0x6284f22cf9c3ba83, 0x0d999d4fb47ef18d,
+      0xe9307eecdc00bd0c, 0x51f74fe9e04fd642, 0x911d53f871157353, 0x0338cad1d24a7dc3,
+    },
+    {
+      0xda9067c321b85ad5, 0x3369b715e3f707db, 0xb5321d572ea867cc, 0x24e3dccfaf535cd1,
+      0xd2e43143e2b786a0, 0x729b2b03e3a922e4, 0x4790be60f7c027b4, 0x2638a00b92675d84,
+      0xa73858f00ed6c8cd, 0x7a03bf67953da9f9, 0x22a5462fb43e8c61, 0x2411e1d578767d88,
+      0x6ee517b413404b0c, 0x2f54ac657ff60e67, 0x0f78814ff49e5a0b, 0x2b22779bb13c927e,
+    },
+    {
+      0x1efc623777c2a338, 0x37225bcf038d4ec2, 0x42bebd087133914a, 0x29401520e923b3b9,
+      0xa21f1696db0cdfc0, 0x5ea578372f0ef3a7, 0xbceff6cf04999268, 0x213d065a0059172a,
+      0xbdb2286ae81727d6, 0x159c0a31e5efa73b, 0x344475fe0d2f7c06, 0x1b24de559b9d174e,
+      0xac39a3d863a62ab7, 0x256ecd835abfd9d4, 0x6171873c428526ae, 0x25faf78234688d52,
+    },
+    {
+      0xc117ec2d1ef4de68, 0xb7fbcac6fee87d38, 0xc004890f0d5dc778, 0x2e7fca4ae44d26ad,
+      0x5bf55121a7cca84b, 0x234f93748a5138bd, 0xc0f720c3e9c1cab2, 0x0d16dcb56be0675e,
+      0x9f056c42622795d5, 0xe1eabe7c33eba809, 0x4586c81543b246d4, 0x2b3bb9e9a4207b94,
+      0x6a5b55d565cb0f89, 0x990f90a94c41e1cd, 0xc3337721e5c83d97, 0x08a58cf91192cc54,
+    },
+    {
+      0xfeb3160174d730dd, 0x5dfa8eec3acd2741, 0x09ed4b446f7c1e4f, 0x1590f4ef2d5e7f66,
+      0xbfee60192702a964, 0x75815c1218274285, 0x33161f40e84a1dab, 0x0cf9c38fa05976af,
+      0x8ea210c3b98c52c2, 0xf84c5c21ae8807d4, 0xd7879d07dcd96809, 0x22441341050c9b8d,
+      0x2ea763591b5fe0e1, 0x2d35f8d38874531b, 0xd392b5c8bba8f7ec, 0x2b01f75d4ee9ce25,
+    },
+    {
+      0x4ddc592a3bcfa4cd, 0xfea29db023e73997, 0xa53d87dfb7e0e2dc, 0x24598c025ec44f12,
+      0x08ffe6d4527631e4, 0x8bac0819db087c27, 0x6ee695eb8e5a2fad, 0x04f75277256b0859,
+      0x4a22433579f484a2, 0x8eec2d34c85e0185, 0x6d9e0a4fb6497a31, 0x1b6870d02ec64b51,
+      0xdb2da98289eaabe3, 0x25aff21bd22f0b89, 0x9dd1dd58a72fd21c, 0x08dda26f68cea04d,
+    },
+    {
+      0x54c671f600a92160, 0xeac7acb32b3d17a4, 0x0e7e8efb11694225, 0x1f64f5118001bd9e,
+      0xc1a19e22c570a30a, 0x97eb87790edb555b, 0x72a622ab19b0bf52, 0x1c19e8b92c149616,
+      0xe1509d682ba33bd8, 0x036d9e4350b9b544, 0x10efc92e0a5c055b, 0x18481a343b6e0236,
+      0x1aafd376d51404c5, 0xb3dea3bf6a004019, 0x88660f8f92400a39, 0x1bae0bd9d8f8efb6,
+    },
+    {
+      0xc2eaa0e5b822571e, 0xce20ec8db06f13ce, 0xc6b005f0c458955d, 0x11f5fbbb6cd4d562,
+      0xafec2df34446e933, 0x3a92e1be5cb8fc27, 0x5e9621e9f747b785, 0x0a821268aaefc27f,
+      0x856b6387f5d20f8a, 0xcb83632c1ad29851, 0xf30987508487e11f, 0x2aa57a68c84f616c,
+      0xb95690fcbee94a52, 0xc1f5125c700329a7, 0x6e48d74504b97dc7, 0x267a0dc4e8810021,
+    },
+  },
+  {
+    {
+      0x54431b1fd5ea327b, 0x9937c24b59216ccd, 0x55410a6d3a3dea89, 0x262df32351accd28,
+      0x50beeafb92891ebe, 0xe30f6ea2b8195189, 0xf7744f15adce919f, 0x208cc03c9ee78950,
+      0xe75ee8b7e7016d89, 0xeaf8092e6f0b43f0, 0x922ce801c4c4b8df, 0x24afeb2be8fdf746,
+      0x8e6cf762839aa27e, 0x9cb2c033f10bdc58, 0x6347bafe788a3005, 0x29627da51337397e,
+    },
+    {
+      0x15cbe7ecc3213e26, 0x2c90fe431ef6bbd0, 0xb4b04415e9c2e27a, 0x280005ef17cda57d,
+      0x0e40ab27dad2e84d, 0xa07c8b478d7789e9, 0xb92cc6661c030df7, 0x0c3202173f0c6cbc,
+      0xc32659d5919ed664, 0x4f14acd1717cb51a, 0xead8c56e581a532d, 0x0453803d618627be,
+      0xbd221551263a8118, 0x461a411c1cd730e4, 0x948dc8006db16332, 0x1ccd2f42bb761c2f,
+    },
+    {
+      0x866e7df147410e2c, 0x45851fa72049150d, 0x0efd302ff2893559, 0x0c6122ecc11ddaea,
+      0x459a8d28fab3aa9a, 0xc383667960ada555, 0x921a4d6aa977c870, 0x300d1bf244cfa7d7,
+      0x3691ab26d094487a, 0x67859265eef2ac07, 0xf5609b19c0239636, 0x1712db2763d24130,
+      0x950936e551b3d198, 0x116b587cb6555f81, 0x5db521ddd5e93e53, 0x0b6a5311dec6f341,
+    },
+    {
+      0x4d7c59cdf55b6911, 0x3e8f09b15e4fe0d1, 0xfcd3837610fbfb00, 0x0e6ddd1bdfae6a0f,
+      0xd80408d0b050ad02, 0xba37492c937886cc, 0xb9eedc6b9ff0b197, 0x1a4aca7b9c449a43,
+      0x0baaf24fc8f70c85, 0x23a5f4f18232b319, 0x535e6bdbb8917847, 0x1e54165e5c777f2f,
+      0x7ae9dc1e7eeb2c1e, 0xf5a699867ee69dc6, 0xfb81820d36f87ec9, 0x298a0e29f0173ecf,
+    },
+    {
+      0x6ac6d258b7c32bbc, 0x90c50f1f3e45c7a9, 0x0db41bff18d6668d, 0x01eb64b260cb254a,
+      0x2f6aa3b7c944848e, 0x8346fb66b72d3694, 0xf87b0679b9f4fdb6, 0x10ed6ac31dfbfb5a,
+      0xe07caeec0ceeddc7, 0xea8dad4eb8a72102, 0x2e382cedb961bd55, 0x23f9fb20b8bc3dc2,
+      0x44016b3f3ad692b7, 0x0e24f13091dc4a67, 0x1419274b41b7a7b3, 0x068aa08130003e51,
+    },
+    {
+      0x97e66efae770017d, 0xc0e4992606c905d9, 0x69b712097eb170e4, 0x1dde58dbd3cff640,
+      0xb1cf1f58ac9eeb81, 0x86a750358282df03, 0x12acdd1747e0c095, 0x00a95d95c457982b,
+      0x50cac114ea88b57c, 0xba7fedce6a165d54, 0x5b70f06962dc5253, 0x0d0cb4d724eeff93,
+      0x98668d650ff39ad2, 0x4c23a0c701ba20dd, 0x91068d9524b5dc0a, 0x21445b95c0d443e6,
+    },
+    {
+      0xb9508e42c233376f, 0x3b7b631d09533adb, 0x2bed5cb7c8c669a3, 0x180dd6f38302c8a5,
+      0x07cf6c8b0074b8cc, 0xb742aafc6da98846, 0xa8a2825098bd6066, 0x2912f7ab39179da9,
+      0xc803c232f2b5cb1a, 0x82ceb20e8bb589c6, 0x56aae4713952c6de, 0x2ee8d8229712ba7d,
+      0x7520704e2b88016b, 0xd90d5717021da6fb, 0xd6b9399cbb1882a1, 0x2536979309f517c5,
+    },
+    {
+      0xd9ab29eb08989152, 0x62dd86be8b4914e0, 0xa7956b20aaacdd24, 0x21a3f3e0bfe9fdf6,
+      0xa2487b102362c800, 0xe3c8722aff6c6122, 0x997745ace43dee71, 0x204fe690d65030b0,
+      0xc40325fb3fa17a17, 0xcc3d5da6ee85a48a, 0x83d76961cc2cf3ba, 0x2b279a85e65ae5d8,
+      0x6ac5fcdbc21fa70a, 0x6b6ca275674168ab, 0x1ebcbff8510d295e, 0x12488d9ffa8f5153,
+    },
+  },
+  {
+    {
+      0x517c00e0b798d2e5, 0x41abb6cfc310fc3c, 0x338c7c6fd4de6db9, 0x016a97040dffdb33,
+      0x72870e92ae11befd, 0xca2ba5b20fdc2bf4, 0x59cfae28e8138b1c, 0x080db847be9a8d3d,
+      0xbf0825b1a2f5e92a, 0x3594ec5631bed408, 0x21fc460de1be2a9f, 0x22d18fd5b9143f70,
+      0x6678a6345b78ffae, 0x23b54ffb14a4e14f, 0x430b342346daffec, 0x18c8076638d50da9,
+    },
+    {
+      0x29c7e88f0baa9f01, 0xbd3b5b120c29ba7e, 0xf99dad98e5e82d18, 0x292d28496cae3fb4,
+      0x4f62218567526af0, 0x1cefc4410045dcd5, 0xd496164a829692c9, 0x04a3def4e15f490a,
+      0xd425ad13342ff9ff, 0xb865b21a96a83a5a, 0xfb729b8833b581fc, 0x05a92de73cc08f06,
+      0x8cf41d4b81b8666e, 0xea7dd840171af7ac, 0x03e542c2154e4096, 0x2558fea5d8c35134,
+    },
+    {
+      0x05f906ffece3da30, 0xafdacb67ecee3d2b, 0x65c5c19263fa1159, 0x2ab77c45f2e90f5c,
+      0x0e59064e88e2c930, 0xa39835bdb253b615, 0x56330873d6e6d7f5, 0x16c70ab77f44929e,
+      0xfbd821103ead57da, 0x8e38a47ab7f6dd64, 0xa11dce80c321c1fb, 0x19fe27169ad7834e,
+      0x66adaaf8b880cb44, 0x39a1a22f67422bd8, 0x528fd36a3f2dfa57, 0x2ee4b1364f2035d0,
+    },
+    {
+      0x5d7ac56483a83f05, 0xb4534b13f04d620f, 0x5d2792a88f835ac8, 0x1308127a6193a46e,
+      0x3e3ea0d026c4df81, 0xbe8a2babf3e9d8d5, 0x7cbb05d712bb50a6, 0x22a751dccb954bf0,
+      0xb59b257b60ee6f9f, 0xde25af4f7191b47e, 0x6d03c6dd4a51b069, 0x135db4768d98aa10,
+      0x4bc6d2faefdec661, 0x50fa6695cde5841d, 0x91291acf770bb84d, 0x12c6de3c7496ed1a,
+    },
+    {
+      0x44f1f1dfd639d4fa, 0xea8fac67e8b9e9ba, 0xca8f80a481ffa1b1, 0x008070fa12abdf10,
+      0xd264ccdeea71d03d, 0x03c56967feb18411, 0x9031d33c55fb2634, 0x0c22be71242f45d5,
+      0x26e3b7e67150b231, 0xa781dcff7f2be1d8, 0x25e99dac95887a01, 0x0421b474b9e2f692,
+      0xf1065044952cb792, 0x733fa751986e5cf4, 0x504f5ca072ef4a27, 0x2a1ccba7fa2e43b0,
+    },
+    {
+      0x97f9d3a8079db2b3, 0xd006e1b89164385f, 0xc58dd4c83cc73975, 0x2c91829d9fecec9d,
+      0x7da0bf3f6e1ba998, 0x870c9dd554700c79, 0xb664fe23b1b1803f, 0x2a4d33ec573ada6a,
+      0x590d80ad289a5207, 0x4cf51588bdc9e4da, 0x7e54391e4a8a85f4, 0x2cb0eea87048d55b,
+      0x5f68eafbcc33eca9, 0x17c9b605f1ee7b2b, 0x0c1f3ec14ecd4099, 0x24ac0bd2b47968d8,
+    },
+    {
+      0x43520f559a7e591f, 0xf7b29851889461c9, 0x4ab8df044e53b999, 0x22f940533bdd392f,
+      0xe2eac5d6e0076a59, 0x7a74789f8ebd9af5, 0xe7725f172a07f372, 0x148688fa13bdf54b,
+      0x31e70457a0b4d494, 0xde006fa2c3b36951, 0x46dfc16a2484ab3a, 0x0bd406189a89748a,
+      0x0fd043b6cf646452, 0x41e8040bccbe1f9b, 0x6cad6a75a52f8ced, 0x2b1533b17470537f,
+    },
+    {
+      0x22892059b84a07ca, 0xb96d1773d566cf45, 0xfe948bf36b760d16, 0x28dd4b1d4b871433,
+      0xfa1dd7aadc122637, 0x3fd702ef4ee5474e, 0xd7154466d79b40da, 0x0acf1a0bdc0d1c6b,
+      0xb42dff76718ab7e7, 0x4acba636c6886cd4, 0x85040f9077603f92, 0x1e9a6c5e191d8139,
+      0xac007264718e6613, 0x509e9de6258028de, 0xc7323e4185dd7442, 0x10f8572ff4eab0f4,
+    },
+  },
+  {
+    {
+      0x626dc23d9489be19, 0x5a0a698e3514d397, 0x576988ec61719b1f, 0x24533000e01e4d06,
+      0x862c273405a3ae53, 0x3719b23791b60a07, 0x06f558b2fd8f9bf3, 0x045bfe3539f74206,
+      0x3b548d48011a4a92, 0x711a8e163c7a5c70, 0x43a9d8df35486697, 0x0afa14989d543c7b,
+      0x7462f12f509fcf7d, 0x2a54316d50845903, 0x48094970dba843c6, 0x0b1188a4f20dd66a,
+    },
+    {
+      0x0a12be5018333ade, 0x26a9e43ef424d514, 0x9efc6887949f23af, 0x0e0fbdcf5f36e19c,
+      0xdc9cebc94ae5ed68, 0xda2dd0d23699068f, 0xe38a5c5f40aa363d, 0x25ade793493d6c6d,
+      0x1cc92f91761f2c07, 0xabbd90ddccce8617, 0x25e2bd9888796f60, 0x071f94925216b8f7,
+      0x051042fb6474b7f9, 0x161ec8c699c06adf, 0x796cbbb81943e95d, 0x27bc99fa010ffb31,
+    },
+    {
+      0x61ab19543f8bbb1a, 0xfcc6c5a27607d861, 0x30ddda0aeb55245f, 0x1e51c7761571ba9d,
+      0x074a5bb1d8035106, 0xa4cf72221e091af2, 0x257c5f5476096145, 0x1181e13298dda63b,
+      0x1967f8acbfbf6ec8, 0xf20354bb956645c4, 0x952c9c9272000387, 0x01ec5a8f1eb57611,
+      0x786df20b06ae2207, 0xb108dd2fb60e7cfc, 0xe1cb16efc4d31e77, 0x060b604af74106b0,
+    },
+    {
+      0x91f034c91092e694, 0x28b5de58d0154f62, 0xf36b5a2cf68493bf, 0x007881632bc803a3,
+      0x92428eeee8e26738, 0x3429a91574a4c7a9, 0x9f3ff36e1314d0f9, 0x0b3216d43c412649,
+      0x4bb5ab38d1e83ef7, 0x4547f352c5954998, 0x51424784eaf30fef, 0x2fcdec5793e24f14,
+      0x05dc66241b5be024, 0x2945050c0baa5343, 0xcfdbe04998ceccd1, 0x11fb1453e9906224,
+    },
+    {
+      0x8d3e24a0ca86e2ff, 0x8a70ca364eaa80d1, 0x35e9bcd0e89ea5a9, 0x17a14faf027a74eb,
+      0xec35105c19b86ff4, 0x64952c5b0b918b65, 0xef065b7f391f9b13, 0x1b1131796072b998,
+      0x74d27b62ab8cb6a9, 0x136378963818f82c, 0x37da523374fa7178, 0x0ab85f9345051d33,
+      0xd54b5cd56cda7bbc, 0x455f160e7abca9ce, 0x5f24d1746100ff49, 0x009bc905eaed7a11,
+    },
+    {
+      0x56a0963e995a8929, 0x737ead8cb45c99b4, 0xc7a1ecbc4a73a210, 0x2daed7aca20b0ad1,
+      0xc17662c472f8a7d1, 0x1e6f0980de76aea0, 0x80574c994da6c86a, 0x2932de9f745da672,
+      0x228363dcf8ca9763, 0xbddf79985a69a962, 0xe656453cb0867a41, 0x1f9859ec88b8b7b2,
+      0x760e1ba6837afb91, 0x15a75732c32242c4, 0x81f4cdd9eca0d4ae, 0x0d7c407632b26bb4,
+    },
+    {
+      0xde54ba8adc14bf07, 0xa41b19d64e1664d8, 0xec28bd2d8590f448, 0x2e342cbbc4b2584c,
+      0x9109d9296e183478, 0x2257fbef58bded19, 0x35ff980d2f7b949f, 0x23e734afec7ebdbf,
+      0x13f219e72f25c477, 0x23782c711c6b86af, 0xa8352748686ed9b9, 0x0f24ff3a0dfed1a0,
+      0xa548a86b46674a81, 0x15d54ce7dc591a54, 0x601d36da58493b8a, 0x11bc49146574b031,
+    },
+    {
+      0xdfd56c747b0801f5, 0x58366c05daf748d2, 0x6f8aed52ef394c83, 0x1b33d7a8d23dc540,
+      0x7c59cb4dca86f654, 0x08013ad697645227, 0xe0decbfe88139099, 0x2bbf8cd758d26f23,
+      0x3adf54b32b3f0a26, 0x3b8c580798fdfef3, 0x56e2b5f0c99a771e, 0x1ede820f44273dda,
+      0x2b02931068b325be, 0x08f584515885aff1, 0x8a8aa5ea5a133a14, 0x1691f123250d4a3d,
+    },
+  },
+  {
+    {
+      0x17c2e2520edf288c, 0x9199831717707f5d, 0x0bfd6f04c84fc9c4, 0x164348c48a2d8d55,
+      0xb989252b2d999ddd, 0x13e93b20915f1622, 0x831d396b42bfa64c, 0x27f9b93722b9aabc,
+      0x4b562724c4ca3a78, 0x1c782673818bb6e9, 0xc831617d68b847d3, 0x205d34ad825167b9,
+      0x164ed7fe03a8bc52, 0x38737fa542fb1a4b, 0xfff3a7a5cac1aa64, 0x236af76368cee8e5,
+    },
+    {
+      0x06a60321833f0928, 0xecef4157e8624c04, 0x30afd3d2dccd2a86, 0x242c9bf21fe25037,
+      0x4c5b3c7db276ec90, 0x6d993f73a2cb1360, 0x3e947fe4a1c5376a, 0x1659ccf5122b40f3,
+      0x1f44f5ed85f1dad5, 0x316f54e0e409de4c, 0x1c25a091bd81bd1e, 0x0aadd43de4b4fad1,
+      0x92ab2da6852df7a1, 0xb7515f6f26dacbfc, 0x54ed72252a30dbb7, 0x106e9d4cfaa90523,
+    },
+    {
+      0x1bd6a732e69d697c, 0xae3263990087a319, 0x78f98acc766c71ac, 0x2865d87aa15b3104,
+      0x190adf37f1f7f5a4, 0xf724e5985c998ba6, 0x61b972445f4e25a1, 0x0e68ee4914c46ee8,
+      0x1bb395325dd203d6, 0xf72c33ef0b960a35, 0x58c6a7e452f86228, 0x2e5aee2abde9d616,
+      0xa25b91c827a8bcf8, 0x472e4182fb28cf61, 0xf714e2883f40b110, 0x1b59716c070e6b03,
+    },
+    {
+      0xf75bff644ff8a6cf, 0x66ec33e98f423338, 0x038610896434f474, 0x2e014588115fac87,
+      0x22e70c0cb5976f69, 0xbe13bf2f5887120b, 0x20f6901622908e07, 0x18db557da40b8bc1,
+      0x6692f49a12d53b39, 0x374dca55006fa475, 0x9b13821c2269a8d0, 0x2a0e2e8edda92b02,
+      0x3cf68bd84dc48bfa, 0x09a84019d2ff7edd, 0xc13c3b0145e2f97c, 0x10e2b88b67643a57,
+    },
+    {
+      0xa505d128e5858fde, 0x01b686fc44d298e3, 0xb99d65c0aa62613b, 0x010ecbb1b1f5bcf0,
+      0xfb119c7c3b3e4a92, 0xff517dc305f1c891, 0x8825f2955c65a3c0, 0x160ce4dfa949b0d0,
+      0x0e655578b1196cd2, 0x0152e639581a91c4, 0xcfa1a85d3d3bd4ef, 0x0d37ac9dc6d4d5a9,
+      0xb972acd0a7cf8870, 0xc3cea7c30104c5ab, 0xdde1163d9ac90138, 0x18fd84f5fbb46f12,
+    },
+    {
+      0x99f3bddef5c17101, 0xbfd8653f2eca244b, 0x02032c5c670c548f, 0x1001a822d2afb995,
+      0x84178c4c35fb84e7, 0x47db4f442008e5e8, 0x0255728a281941da, 0x2f144f580e68b95f,
+      0x0571c171ceb625ec, 0x326a2f2058f95c93, 0x74ad7264dd59fb69, 0x0d4289f8d135d6e9,
+      0x2bf7fc27be15354c, 0x53f5c7a2e7e6e2a2, 0x6d228d45412a4498, 0x27fd18d690c75193,
+    },
+    {
+      0xaae6a502115861ff, 0x8ae35737aad58667, 0x40d8fd04b0e4b73e, 0x1e0c71c25712d90c,
+      0x022fb38fa99b1d14, 0x96c4a6d0b08a60a6, 0x2f5f04144acdecd0, 0x0918175284c5f6bb,
+      0xfbf090a87883b57a, 0x6bb6349414b0f4ae, 0xb384ca91affc6883, 0x0226d434788a5547,
+      0xfd2e76c90186a7ba, 0x92e0192dc74bdd5c, 0x111fe6cb0cd25924, 0x2c0ebdb55ba0208d,
+    },
+    {
+      0x434a3b0e3791456a, 0xcc98b55ee77034f8, 0x9a25bf7a5703e437, 0x1301e474257d6441,
+      0xb115139974adee36, 0x9be5903642c099e1, 0xc2278f724b31f3b0, 0x2e0418f8e03fa585,
+      0xdc1f414defb6f7a7, 0x62d04b1f747bbbb6, 0x8c1c0b83dca7e85a, 0x1f5790456d2da474,
+      0x46dca2ea4a4f846b, 0xbf4cc6d5508a42da, 0x7a3828366da5fc54, 0x0d8185fd898a7fdf,
+    },
+  },
+  {
+    {
+      0x8f9283b05e276215, 0xefc159835f08d124, 0x6ba9d0abd844f346, 0x0253f516272dd570,
+      0xca62d722dcb6cc32, 0x8da9417c0ce7ea72, 0xaaf70fab50c7947e, 0x14b126c080f77495,
+      0xb1a482ee007a7c68, 0x187e855bfac4293c, 0x732a2e302fdcd50c, 0x27bb76af70f862f1,
+      0x2bf75c20e5b14ad6, 0xf198d36b268fd486, 0x7b890e9448e8e1d7, 0x19d4d9f7efd6f2bb,
+    },
+    {
+      0xb616ab681cad58c6, 0xac6e7cd86ef75e45, 0x3bc14886ce700936, 0x2140b88d65f6983f,
+      0x8dabf5a6f34fa68f, 0xf6cb2fbf547b7321, 0x9bc2537880c842df, 0x15dbddbba35b37d1,
+      0x83dbd5a37b6bb7a9, 0xeb591c287ea151f7, 0x9e5f29a0d829cf3c, 0x0df7f94600332e32,
+      0x3e863978fe3491a3, 0x01caa2be627715ea, 0x322da4c2c7703e79, 0x180057cb8146256e,
+    },
+    {
+      0xcecd2b5ec02e2be7, 0xbbae3364e1689ef0, 0xf3f78ffceb4bbe64, 0x0927cc9c338ea353,
+      0x3c8c7bad21d270d6, 0x6a4c19644ec8593c, 0x235561f0e324397d, 0x15855e8dd99d7961,
+      0x53ec270d6f36be8a, 0xc1e47cb21fa80489, 0xe5536d51c44d09e1, 0x0a7ccb8a131b90a8,
+      0x35fa1bf88df80c3b, 0x01ae5185f4cc8480, 0x0c2d22d77085e918, 0x123f89f01fa6164f,
+    },
+    {
+      0xfcaaa4f05564c3a0, 0x22a6a39e13919287, 0x0665783e2a93035f, 0x0f6cb9c6e44304d0,
+      0xcc4a083ea8695754, 0x2f92292584a7b764, 0x733c617563318a6c, 0x1379bab49db70d0f,
+      0xc9b9f5c730a52043, 0xf0a9abaa1b7c6933, 0x566b160f905edf2e, 0x2fb77425eec47aaf,
+      0x07d0d9e42de86c0c, 0x953d58680e876d35, 0xbc6664b5b0af5a16, 0x2023cf3398961be9,
+    },
+    {
+      0xf728f49826431d10, 0xf75fc04ee1302f07, 0xce76523618d80746, 0x05b6776e7bc08cc5,
+      0x8a896efccd6b0d34, 0xdea42c751d4f2abc, 0x7b52decc42fe1fba, 0x08054dc253595828,
+      0x33aa2e3f22b8950f, 0x709c677abe033bc0, 0xc7dec59e26f6c753, 0x1d6fb6c7f40b3d98,
+      0x4748cd69b97f60b4, 0x157c7935d601a044, 0x3e65cc71e5717775, 0x034e380e7d800757,
+    },
+    {
+      0xb3afb8515d2f4ce8, 0x10b2ee5c0f0bb103, 0x2baa61b41a562b25, 0x20c69d6408b8094d,
+      0x5a72dcbd5d68766c, 0x34b59ab297d7f839, 0xb18573fb426d2eb9, 0x0e13818da8e83d49,
+      0x5e00041c27033092, 0xab1208cdf8ec4cf5, 0x08f3d4977ec41529, 0x1b744d85542d0c7d,
+      0xdbbbe00040f72b48, 0x709c246aa077f792, 0xee1510f664cb9a5c, 0x160427c7c4d82009,
+    },
+    {
+      0xba8da3d5514b91e6, 0x2a219de0a364b822, 0x76c41e8a96b53b82, 0x04cc5bd7b05eb002,
+      0x197bc38ae9d9db95, 0x54aaa390c4e550ad, 0x8e2979f4c77c6074, 0x04682842bdcbd28a,
+      0xd8f0ed2b3c6f518c, 0xbaf1f61ca0c69ef7, 0x8356247c90f3f166, 0x03f4e601dd6cfd1b,
+      0x2107b17fa832399e, 0x857d8d6331d08980, 0x6818ada52886a3b0, 0x27e4db2667b1bac9,
+    },
+    {
+      0x613b54792c0a107d, 0x639e42637643de4e, 0x5551b50e0fb46a45, 0x29e756401db95ee0,
+      0x9cf5164be99b9693, 0x677fee67e3c1372a, 0x1280dee0998a4ec8, 0x2852f72fe243be6d,
+      0xba85aea7a3ae7c76, 0x9948e7ea7e810736, 0xccad27182956c96a, 0x08b0d809fb8225b2,
+      0xc8eef5ddf13a6227, 0xd76d02bd2f6b9c06, 0x9c04895951f6114f, 0x0aa1cf18d3bd379e,
+    },
+  },
+  {
+    {
+      0x2970cedbcf06a93d, 0x7e71d7861aa07813, 0x81b7352c221fb64c, 0x2a052d0b000aae2f,
+      0xe9fea8d7d32b6ac9, 0x2123dab9f64e3eca, 0x222a8bb0be5d441b, 0x25802ccc77262112,
+      0x7d2e89d196c66a31, 0x2a6389511c008c1c, 0x249cbd15dbbd3bd7, 0x2313a0c17b62f8f0,
+      0xfa5910337fc396c4, 0x284ba5d368daeaa7, 0x9666c52e562d8f75, 0x16b63f1268c8100b,
+    },
+    {
+      0xea1d4596b53d0290, 0xd40a1e30b28b7611, 0x73bfa01988118ac0, 0x13b7b63b7dafe45a,
+      0x67cf3c8518d2c23a, 0x0bd63cbb7641caa7, 0x5d5c646d12377dbe, 0x24d4d31733349dde,
+      0xfa60cce46cd4bade, 0xc843337bd755f96f, 0xd4aef45172ca25b5, 0x1ef8a923297b4981,
+      0x750de86ec79807f7, 0x9b1521ac15c700cd, 0x69e85cadd7c0a67c, 0x03fb768e935547df,
+    },
+    {
+      0x37e6f9b1faf9df22, 0x022fb6b6358c5c7f, 0x468a45de766cf677, 0x2fd95ef4ef806e9b,
+      0x9e65ca8c11bd17bc, 0x539cd9572d4edebb, 0x74e05a0290238ead, 0x14951b1e29c71f99,
+      0xaddba9f4ededdcff, 0xd2d7967da812be68, 0xbc363960de614f00, 0x21819b35b614058f,
+      0xb0d3226ba0e1c87b, 0x2f5e98e009cb4cbb, 0x2e554596b1ce4486, 0x1dd53dc830a80e5e,
+    },
+    {
+      0x6263203a862129fd, 0xb0435a05e46550e2, 0x9c1d856be4969708, 0x08f912da49f559ab,
+      0xe79108511d7d514d, 0x0c3477534147d300, 0x25744764e5d19596, 0x19ab03e1392465bb,
+      0x978cc83e256f5d52, 0x9b54f058c4b87ea7, 0x37072efe46821cf5, 0x1d4f749e486d0f26,
+      0xe3adf2c6cf3c79e2, 0xf9b3d18d17b21b30, 0x97c8a5eebf8f9625, 0x2fd14c3b254253ab,
+    },
+    {
+      0x330257ef018aec82, 0x036a905fd286eef3, 0x70b022eac2613df7, 0x0986cebc01d5d542,
+      0xea0d8f6787b3d32b, 0x47a1bb99c826cabc, 0x6c35d351de084fa6, 0x3017c15f20e031e4,
+      0xeecb1946b689fdfe, 0xeeee79a33e2ecace, 0xa7fa4885f1457270, 0x217aa2170c5874d8,
+      0xcb1f4dd9345a64c6, 0xe77297e5deadbaa7, 0x69955f97ef227d12, 0x18db29e018019c70,
+    },
+    {
+      0x2b5fd9316512ce3b, 0x40e67119b9cae05f, 0xdb23155383f9b9db, 0x058def53c6877fba,
+      0x860bf3b1af155964, 0xf667cee198ee0934, 0xdd9070529c597834, 0x2f2633678438a210,
+      0xa4db4e5038ef677b, 0xbe4180dcbc26b54f, 0xd63b3e08c523c4ae, 0x1ac2164d15eff624,
+      0x54d1416b9d3670a0, 0x3df2b3c4a5a541c4, 0xb439c555d3f7a1fa, 0x13778101184a7562,
+    },
+    {
+      0x4f159df178b0fbfe, 0x46b90f610a3e3338, 0x2c1d3e4a5cc237be, 0x19ac0fda3bb8a641,
+      0xb861eeb0022479cc, 0x30337c9155957204, 0x44b5476387de86a2, 0x0017ebdbb70ddafb,
+      0xf5f3c1982ae7bf20, 0x413d1536338875a5, 0xe7b70ab4dab3af8c, 0x073af00d8d26e9c3,
+      0x1a9f83ab2fd5dd3f, 0xa33f1c9ec4fbb225, 0xb3563925feb64fb0, 0x2cc7db34ba6c49c7,
+    },
+    {
+      0x832ceb45dc68cd94, 0xda9b0160320f9471, 0x7b7dd8a37f8020ef, 0x27da1feb7929dc9c,
+      0xacf62b306ed15a28, 0xbee402144b3940da, 0xfa190eb8470dfcd6, 0x174f2e130f902ce0,
+      0x207ef8fb764f7485, 0x250e443ff36fb179, 0x4249893106403bdf, 0x0d50d58bb1f2529c,
+      0x509df6d515127da7, 0x2262a1a722402927, 0x0c4fe056e7ac9d19, 0x01328e98761fe172,
+    },
+  },
+  {
+    {
+      0xe2806fd1989c072c, 0xfbf1f0c878c8b2db, 0x9e6d1e94ea43823e, 0x02e2a1c166ddc891,
+      0x306ae5d739bea93e, 0xdc88ef9789a6bcd8, 0x88816d126fd31a0c, 0x21782e8be4f0e534,
+      0xc0a56a9535cee90a, 0x972b3f79bf6b75a6, 0xaa9a64e23379dd1a, 0x0c2816c355ddf09c,
+      0xe44fa8a55a5dbb2a, 0x910d360fe5dff031, 0xcb0aae77e3425285, 0x072ceac2ebd24a38,
+    },
+    {
+      0xf2cc980292c1c0ab, 0x89e47772f3da2b9e, 0x0997d8bce1b39537, 0x2eff06b268acc0fd,
+      0x891f128d6fe8fdae, 0x939a2667da13f335, 0xf601f3b69b227c1a, 0x2df988d36e8ac428,
+      0xf635267e2b9304a2, 0xf4d08775c91ebfec, 0x7b3e4e036a3f9eb3, 0x211aa16c538ceab4,
+      0xfb074379eaf56831, 0xdc4ec2152c17b41d, 0xdb9469c5afaf8ee3, 0x24fae5c2d595f879,
+    },
+    {
+      0x1a014c5962b53746, 0x8fc57bcc6babea23, 0x84a1e86e86862ca3, 0x0ddb567e21cfc328,
+      0xcb240a4359791d7d, 0xce6648598a4308e0, 0x84ed7391c0ec1e55, 0x0b3e867f005a5c8d,
+      0xebf0cd69252a8e7a, 0xe76ed2f7b2f1c4e4, 0x52f5da4a1c8d5edf, 0x10f2a4e2b7ef6d85,
+      0xb44675d6bd1d32e5, 0x790a4e89c6397dd8, 0x4c8baa6d27702937, 0x238f12c183ab474b,
+    },
+    {
+      0xb49c7796fab6020f, 0x8ce2551cbf3a4392, 0xa198540379678463, 0x026b7ff238e105e1,
+      0x34be06a6725c5333, 0xcc7a30f02692f6a2, 0xcf90b86ab83d1775, 0x06b7851eff040046,
+      0x2042695f8a05a8a5, 0x92ab003aa66780f2, 0x8f3b08ab057ca8ed, 0x1f0fb126e545e757,
+      0x00edc0f55009ec56, 0xad30ca48385ff5ff, 0x57c784a7278fe47c, 0x1bc231f278714854,
+    },
+    {
+      0x88359beadf16cae2, 0xc9d14d5652920ffe, 0x0c19bcd272d32ce6, 0x22c2e1b1b6d4c79e,
+      0x03b2ca936d81d6f9, 0x6766b7de86141bea, 0x77872a1c16151ba8, 0x07545f6cee3be23e,
+      0x9973c18398fb3010, 0x8835bad4df87ad81, 0xf7f1891c29c174db, 0x213a9d7e4c97220f,
+      0x0e8103184db89f89, 0x11752dbb00a67a5c, 0xd648dbbcf53951d9, 0x10e2ec93767b8fbb,
+    },
+    {
+      0xa50912b938374940, 0x90b630814263d7cc, 0x12298f948b790a16, 0x17d4be2ba87908f1,
+      0xfac1b421899ed724, 0x532b07a26595dbee, 0x163101bc756ece2f, 0x1089fa8edd2cc2e7,
+      0xce7db39fd9ccb0ba, 0x67af59a2581046b6, 0x5ce0c132ed42f268, 0x0530abb6bca25842,
+      0xbd4c8210730eef63, 0xdcc276950242b2ab, 0xc9ff0f6f7c919b82, 0x11940e40824f49d0,
+    },
+    {
+      0x00bf2f3e22eaf950, 0x14ca2cb3b91aa668, 0x1a41c149b5b96cc3, 0x123001410a597b87,
+      0x509e71b87113e020, 0xfe901182656b0c54, 0xb947cf372305c219, 0x274d00768637629d,
+      0x3e52533e9a5ba598, 0xc8c3266e2df4deec, 0x66ab9dc8890f00cc, 0x1ac9a8f650a80895,
+      0x62dbf561a20f066c, 0x9929f319d191f1c8, 0x08b63f184818b06f, 0x17102ed74c8bfdec,
+    },
+    {
+      0x98a79aac965af45d, 0xf6176af688504941, 0xd984dbf5c90e36b6, 0x2a9ca37c21895bfe,
+      0x4e9c93297df8dc20, 0xa4954214861cc64c, 0xb296e3e0a597ea60, 0x10f23534b0eeb55b,
+      0x5d33dfa7cd5ff410, 0xc125592759a1f52c, 0xec765c003f3e9421, 0x09b3dc5c1463a942,
+      0xc96ac1d2d312d087, 0x22e2899935efdc2c, 0xa22f118bd1f61bd5, 0x0de687ec2cb740e8,
+    },
+  },
+  {
+    {
+      0x418b08adef81d053, 0x3774a244388da4cf, 0xda7bb4e5c0805487, 0x1b580f015e533b7f,
+      0xaf64d25734d73754, 0x1704061ec610dcc5, 0x2423503ec0daf3ff, 0x04880cf1d57ae644,
+      0x1d7144d46ac508f4, 0x0f86d43897307a38, 0xb03462b7aa677f1f, 0x1f661a8d0e61d720,
+      0x770d94909230e53f, 0x54580515e81aab17, 0x5a47ec4ff734f51a, 0x2e2550134ab27083,
+    },
+    {
+      0xbbf0240055a67759, 0x91259e599ed556e8, 0xac5f59ed1f4c0529, 0x1c90e0355663a198,
+      0x6ba72920bb054492, 0xe26a4ce3fac90a5c, 0xf591d3fc824a6c48, 0x1a215aac3a16f699,
+      0x451aa8d9b342f171, 0xdb622c40718c710b, 0x47cc56cf0b0cd88d, 0x0815ddb55afb5f27,
+      0x472f3fac9950f620, 0xfa37c47938874737, 0x5e4610e366c183e4, 0x16d9e9bab82a3a35,
+    },
+    {
+      0x398047d842a6d612, 0xe6053023be477c0b, 0xf35278b71c9f157e, 0x15c6009f678bb64c,
+      0x792dd372a7acce45, 0xe9aea3370a1dc7cd, 0x9642c5ab62f8acba, 0x192d490fe6250241,
+      0x790567031a089ed8, 0x802f04f0e7b3419c, 0x2fdc48a8844b16e6, 0x0cd5e92ac87b77bd,
+      0x317334658aaf6db7, 0xd4488a2ef88d02b6, 0x6bd30d59840aaf7c, 0x2bbf63e7b127cf4b,
+    },
+    {
+      0xa9b77001bb4c4c7d, 0x69c03bad41157daf, 0x59195d6a761244aa, 0x10e9584bbf431ca3,
+      0x9d12726d53f88583, 0x4fd2127e2d20a2fa, 0x2d31c6933cb515b6, 0x1ad0846b0c2249cb,
+      0x34965e9bedae55d9, 0x2d6ee38a53595ef3, 0x54ccfe93ab88fcad, 0x03cd977ebd8fa7a7,
+      0x654056f924810a16, 0x9d25d9a63c7fe005, 0x5080d48a968cd737, 0x1a9e332034dbd3c0,
+    },
+    {
+      0xe3ac6f789139f496, 0x7d2a5535abc7d4b2, 0x4a6157a8815df56d, 0x076e0633df60aa1f,
+      0x28d0531b15ea9cba, 0x13083c96e826fc6b, 0x77f8e0b43be018f1, 0x2a943b369e297102,
+      0xaa4b53acb1628104, 0x936cb530ac393b4a, 0x864491a059d40ca8, 0x1626b9f2c599d2c8,
+      0xa1ea2963d80f638f, 0x53c2fdb953e04f5c, 0xa2660a270c6af154, 0x02564b11fad65a07,
+    },
+    {
+      0xe4dc2759514e0658, 0x5086be48f847cec4, 0xe2d56a38cf83090c, 0x0cd3f4fd1380b04d,
+      0x4d9cb28663c437c6, 0x40047dcf589d6f35, 0x6b7a4b78883c677e, 0x1604759368034e05,
+      0xe82d10954797e016, 0xa1eb6654ff0d3795, 0x35b88511edf6cedd, 0x152bb047c7daf8a9,
+      0xfd0e898aafa5572c, 0xf39ae2a9dfdb1c54, 0x6787fbd72614b5a6, 0x173a688509a085dc,
+    },
+    {
+      0x36ff2df56d80c170, 0xbc11bf78891ba5e8, 0x4cad32496c9aeebd, 0x2dbe07884c993545,
+      0xb0644058e3811996, 0x3c7d872057fbb2f6, 0xd5f4528c1d64e9fc, 0x1313a763900cc522,
+      0x33c5077538b45933, 0xc3107fbae4072d90, 0x9b026dc5afcdc5db, 0x03d4b2d1c0c4e858,
+      0x8451ddf5a7bf2924, 0xee2a6246214512d2, 0x26d93776fc0912da, 0x28a1b6b86ddbf8b2,
+    },
+    {
+      0x90247d94c80db100, 0xf79f107852254a22, 0xf19ef1166472d1d1, 0x0b02baab90899d31,
+      0x73b0b31b59e1dd12, 0x6674be316038a140, 0x34b24b464fde4b17, 0x1b205dab25eee7fc,
+      0x1e4d46c134a151eb, 0xde787143b274cdb2, 0xa3cfdfa8f9a5f9d7, 0x030e00cc370a6e6d,
+      0x2af6064348401cce, 0x0be1068c2423b591, 0x51ec1492bc5b6c73, 0x1a22fecd566f6ce1,
+    },
+  },
+  {
+    {
+      0x52469ba096a05f8d, 0xcb0228f4ebf6799e, 0x257b75c7ea98a49f, 0x1962a7cb050bb03e,
+      0xd5202840ba5a1df5, 0xa1f9908021b82081, 0x224bbfddea0c2332, 0x00f9ecf66558f935,
+      0x80d20d4849dc298b, 0xb7f06665e5c2976f, 0x4d48e7d957250fd0, 0x25e0572ad9cdef9e,
+      0x8c70ae35e9f3f5b6, 0xa9b9e6391d310c0f, 0x75306efe97fe2696, 0x04401e035007a91e,
+    },
+    {
+      0x59f534d54b144775, 0x21fbb4eebbcaaed3, 0xef561b3602e7b663, 0x048ce441bf6b2099,
+      0x190a60659fcd5c93, 0x2f51c13a1edea269, 0xd156b9180808ed01, 0x0814dfbb1726fc61,
+      0x8c1de7cd4773d2d5, 0x3951a3ecd2b7af57, 0xa90269b5b0c81147, 0x237459ae1bf4d32e,
+      0xdef109141189469a, 0x7bc2e1d977fd98b0, 0xeacf2993aa4ca769, 0x15b619ce83e480ac,
+    },
+    {
+      0x72cd6bf445079f97, 0x78fa9656260c3dd1, 0xdde2550f3cea41c3, 0x0f9e9f8c68d0fd82,
+      0xd89528aec6c8f2d7, 0xd6606f328b7f6013, 0x0fcbc839040ed2d2, 0x2fa825126ae8870a,
+      0xe55259801409ed8c, 0x206709e16624f0a1, 0x75c6ba75da8a00c2, 0x30531457a1de315e,
+      0xe0a35323bd2007d9, 0x89e1ae313cf436e2, 0x698130d7e3f023fa, 0x2d6a2d2f84807a8d,
+    },
+    {
+      0xbd7f2b83d7cd8590, 0x1f2f9dee091c6e70, 0xf2f17d2675a466a5, 0x201c271a8853c3c7,
+      0xc9e0fc1e42622635, 0x357daf29516e9241, 0x787c70f68588a9a6, 0x0cb1fbf923a285ec,
+      0xa97f0b020789c14b, 0x28b78f18e5cf6348, 0x415e1b757d9beb39, 0x2b95cf3ab97b3cc3,
+      0x5b11e871f3b36c93, 0xd37397764039c292, 0xcdeab189e718de91, 0x0e4f2df1d74fb1b5,
+    },
+    {
+      0x732799fa8bcd69d1, 0x86194a5ffd07268a, 0xd704ecc52b273856, 0x057882d78f00dbce,
+      0x1d900019d718fa1d, 0x6187cf92aec2ca23, 0x7ddf89b2692af8b6, 0x11204f79bde823a6,
+      0xc49f676e42cfea6f, 0x4523a9c7ea705c22, 0xdd8c57eb80e63978, 0x198d769f2ff7f507,
+      0xc789eef8d0ed1e8d, 0x5605be2845444e55, 0xf8725ad53ed13292, 0x0a3d43d9fdce7ff4,
+    },
+    {
+      0x2f191714682a89b4, 0xa76d157a4fa13c4b, 0xfa50cd5201c6db8d, 0x00aa380d797f206a,
+      0xcf48a53b98bc27b9, 0x42addf53f73dbc64, 0x0b6083b07339a20e, 0x2fbdd67c5769e521,
+      0x25ee847e5756efbd, 0xd0f0ae9dd8b912a4, 0xa74c8bc9c666feb5, 0x066c3a30a40f511c,
+      0xda3d6e1e46eb87f1, 0x532098951c18466e, 0xa8c6a71287389b8d, 0x0dc911f68288e073,
+    },
+    {
+      0xb8039c36d74cb042, 0x024a4249d2827d2e, 0x0cebdb04c9424b3f, 0x1aeebe552bb2674d,
+      0x3547bdc5293f3c03, 0x3a19deff13a3586e, 0x4627c9e08d6c47c3, 0x0f37adc81fdf7706,
+      0x9ecbd409d0708e17, 0x7f19b6a46bc52120, 0x5a95f0469de6af54, 0x0aaaae50ad3676b6,
+      0x2e04e691e3394aef, 0x3e90c84458bf36e9, 0xb321c806394521e9, 0x2bf5f0efdb44037d,
+    },
+    {
+      0xa66b3ab7d825ab45, 0x13dbe033e3e24dbc, 0x5191f00e1ecc4914, 0x2c35fe0467aef608,
+      0x2c15779cdabe5318, 0xce4dc233e2873fe8, 0x658a3ccf8661d6d4, 0x1c5121e790445057,
+      0x732afed6fefddf9e, 0x2fffa518fe5adf57, 0xf200ed282fa1a9cd, 0x12b0a589cfdb757e,
+      0x280f418517ab2cd9, 0xd22d5d503ea4135b, 0x56bcbc6f7c829e15, 0x13c543087e4ee37d,
+    },
+  },
+  {
+    {
+      0x95bdb19e5171251a, 0x0dc597606db0c6d9, 0xa6ac874de4206d55, 0x14764fb3ad3084f4,
+      0xc0b716fa4f2b6a4a, 0x8a255429627bbde3, 0x1c43d7c4ade5fd67, 0x0e3eda7503bb5d1f,
+      0xc15485afb594a9eb, 0x5d40be6f61327b5c, 0x1ce64960b2f752ad, 0x2fecfd19839cd52f,
+      0xdbfb01b18e858f93, 0xba2af7cdff93a4bf, 0xe86d890bd4e538a3, 0x1d791ac3643485e6,
+    },
+    {
+      0xd56b2c38b2a464f7, 0xcd49b6e80cf38bf9, 0xe2c0445892f50da3, 0x08d2fa469f3cab12,
+      0x8a78d9c6352fe21e, 0x1f6f7ac1fc3bb669, 0x38c04ba467b1d1fb, 0x18cb9a4f5a1b46c8,
+      0xa60255379e07b324, 0x1c2a1e56c9dbf529, 0x24578e23e6c1731b, 0x090ed32972912d59,
+      0xaab07121fff4c5ba, 0x09a474e2f445dc75, 0x5b2b39be6e2765de, 0x294ce60215949058,
+    },
+    {
+      0x1eb8095b0fb83b34, 0xd9cf381a5f1a1006, 0x46b0eefa0814e875, 0x13f13e8f532c8948,
+      0x54b31d096c1d1a83, 0xee9fe0f9b2154ca5, 0xffa376709b2c0f2e, 0x09f2e1508f8085b2,
+      0x8b2d0220acd7ccbd, 0x9e7c2bebec5e9bdb, 0x815e10987e1bd6ad, 0x27e02b939ed327ce,
+      0x496be1791ae2f043, 0x25d539da98e8213b, 0xb32f0d41cb04ed6d, 0x21e94bf347fec7d5,
+    },
+    {
+      0x607ed0a66f4983d5, 0xe728ccd6527a8262, 0x06e1cf567bac3cb0, 0x202f4f7528bc7d31,
+      0x70da73e56536d384, 0x15d29c3a045b580c, 0x66abfb2b7e310f1d, 0x1a60baa1830fb99d,
+      0xe2f32cfe9d77bff0, 0x5b98b93cb9c20e71, 0xe6f4fe52ff8da79f, 0x20b19d31fa10a78e,
+      0xf9b9aa2e0367e396, 0xe128f1eeb34dfe1f, 0x6e386c9d9b625616, 0x2c39364f1e67c1a6,
+    },
+    {
+      0x970185538f80dc93, 0x226609f87ebb4fd2, 0x22a70aceaba66dbc, 0x0d46dd815aca614a,
+      0xa28432b553167c47, 0xc898e5aaa984f7af, 0x106f6962b8c8c615, 0x00e9151d97e46ae9,
+      0x2fa02ec1802fb2be, 0xc008183cff0c7932, 0xf1cc26fedffb3604, 0x1fc7c7ee3c6c30e8,
+      0x5cf36f22f0b7c66d, 0x386cd234367a37ab, 0xda4198f3e333dd32, 0x0c8695fc1a21b7c1,
+    },
+    {
+      0xc9132fb0b9e24933, 0xbef29bd8bd189c4a, 0x47feaeeaba3f0cfb, 0x0d6e4735faccabd5,
+      0x4bb37e52b84bdfde, 0x82835a560ef292bc, 0x80b87724671e18bd, 0x020fea6782253d3a,
+      0xf0c8c11c69f935f5, 0x137cfb5c15e73d0b, 0xef293004b5daa68f, 0x1206e1f595152c89,
+      0x4e4195382f91512a, 0x96a508d06d09c907, 0x69d321c8117f32e9, 0x0f24464534dc74ff,
+    },
+    {
+      0xcc66a799090291a3, 0x6753e35a0f93c79d, 0x6020ce5704cb2343, 0x0ef4b73095cca0ec,
+      0xbf4f5782d1f642e1, 0x181c2d473f7ba4e0, 0x9f15cdfeba3602df, 0x274f1401b496f530,
+      0x6e153df68294742f, 0xea4bd8851de85da4, 0x4b7852df84dcf639, 0x107a1d6d4ed24c74,
+      0x0bbf8b4cdc248827, 0x76301f8a23493ff4, 0xf959a430d35268bf, 0x1324366babbe5908,
+    },
+    {
+      0x52cb397d492335cd, 0xd7fee5f8ff50bcf1, 0x7ab54b375e77d19f, 0x0ad4f15c9d4da4e1,
+      0x65425ee8bd93041d, 0xded643de70206060, 0x4fe1563a0383384d, 0x09681b1c83eb6417,
+      0x658382c61e2de40e, 0x6def3911d7e503e3, 0x7fa75e0a57584ac0, 0x02468813b92bce5c,
+      0x282c4faea469da00, 0x0b66ed08118d2d3b, 0x5b76770e1313a4d9, 0x2bfdcab8da678288,
+    },
+  },
+  {
+    {
+      0xb2ff0e9aafb08cb5, 0x0bc299e7d05e3ed0, 0xde1312fa0e303e49, 0x181d32294f41bf64,
+      0x75ddaef540e28859, 0x73da3751d2d1bb0a, 0x7b9d5b77e7562305, 0x1bb149d65d08809c,
+      0x4c32bd3be93217a3, 0x42a14c4a4811f388, 0x717c4111f8b0fff1, 0x1c32ea17d5acf3bb,
+      0xae78d047ed5f307f, 0x292a32c2b2134f31, 0xc72a141b6fa4ee1d, 0x1c5ab76291a20cd4,
+    },
+    {
+      0x520f0e2849bc7490, 0x81fe18e48f14ff81, 0x0b914d5cf0aa308e, 0x0fccc187cedb476e,
+      0xfc6f0154fea6e47e, 0x57c8497e211c8d04, 0xa6f5206625b63e00, 0x27fef8752065d4d0,
+      0x7f94b738204314ae, 0x0954b46d280571cd, 0xce36ada0e8393b25, 0x006a2f30f366d253,
+      0x2f8898a7dda647c5, 0x3ea173a3a0ff63c1, 0x3724381dd8d52e08, 0x0a64642bb4068f1a,
+    },
+    {
+      0xbac3097d120fa4d5, 0xa0aacee6e925e35a, 0xf37a52587ef783b1, 0x0de447585984351d,
+      0x65674bdb9e1414d0, 0x0e4c262fd0f1b78b, 0x338f253a228794e3, 0x16e5c1f630a442b9,
+      0x6ff08e7b4e40021c, 0x858d5c81ea7564b2, 0x51daeb88873b39fc, 0x2e16d56e013b0063,
+      0x09142ed33f9bcace, 0x66f66726ce6cc41d, 0x7262913282bf08e2, 0x0c44a44d56069643,
+    },
+    {
+      0x94eb57ae3b3105bc, 0xe0af16680017a9a1, 0x2af0be322bebefd4, 0x2fb68e13be8995a5,
+      0x1d1267cf247bd3b6, 0x08b468c7d69732d5, 0xb105db532d04755a, 0x26829c3f2086387d,
+      0xbb9ea0d00ee0604a, 0x21f8f950e8a0979f, 0xedbdd1f87af09629, 0x22dbfdf6e6286d97,
+      0xc458f118aa3f7523, 0x96947192e74a575e, 0x7a4533b08eb0c0ee, 0x092bc8b76992a825,
+    },
+    {
+      0x9a6417b3722bbb8f, 0xc0d1ddec3611e48c, 0x23f1c307aeffc6c4, 0x00e46ef143eee32d,
+      0x8385ba020f4a3d0a, 0x445583f706d61f9a, 0x20dfce5120468f63, 0x2628c310619b1eb0,
+      0x56f00c6e817fad63, 0x0cd85a6e63dccd9a, 0x6743ef62e90ac8df, 0x271800c1323deea4,
+      0x22a0ee564a51055e, 0xf63d58fdc3352836, 0x01bdc74bfe8d9bfe, 0x0d1c9995918ef49e,
+    },
+    {
+      0x9b9a7f63aa99d191, 0x70150a34aca3a920, 0x06fe4124028f4189, 0x2deeca0dd514d5ea,
+      0xa970b555f0b58734, 0x12e982ea383ad6b2, 0x49591e43939f201e, 0x0d272099a2568fce,
+      0x9fb4489327514ab0, 0x6d3271b870824337, 0x5103ec6f253c4af3, 0x18eb53282c39992a,
+      0xd469cab5735bf975, 0x53497a23f9952eea, 0x705bea541e20c788, 0x213b9916226641fb,
+    },
+    {
+      0x805215bb03d060c5, 0x2840796b3582823b, 0x46a76c4f88caf192, 0x09569ed0bee96487,
+      0x67c14417c2b3c5c3, 0x497922866d4f4d4d, 0x014d790a0ba9c8be, 0x256f50f684dabca8,
+      0xea1c53da3c488d67, 0xdcc57a908f5fa8cb, 0x4cc07b9ffc702748, 0x2e0df04183ec54b1,
+      0x6d72d9d257fafe69, 0x5224303d10a60587, 0x38205e33042f09bc, 0x20d0101dd922ad52,
+    },
+    {
+      0x911b2b50be65d197, 0x4b16efbf7a88e392, 0x8664c3f8c4ff988b, 0x12e8e0999af0111e,
+      0x0f3749139b86081e, 0x62eb31abb306740c, 0xd6b46b664a906665, 0x2fa58763339690b5,
+      0x9da3c838a4fdba92, 0x38763d7cc4ceedb9, 0xe44092f54a7d533e, 0x021c1027e039a34a,
+      0x1ab1c13dabaa42d5, 0x1e7d73e597c341e8, 0xbb71b5a9ff7645b2, 0x2f2dc9fe07fa8e32,
+    },
+  },
+};
+// clang-format on
+
+} // namespace bn128
+
+#endif /* BN128_MONT_TABLES_H_ */
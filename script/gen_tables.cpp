@@ -0,0 +1,54 @@
+// Writes include/bn128_mont_tables.hpp, the fixed-base tables of G1_ONE and G2_ONE in Montgomery form limbs.
+#define BN128_NO_GENERATED_TABLES
+#include <bn128_mont.hpp>
+#include <cstdio>
+
+using namespace bn128;
+
+void print_fq(const FQ &x) {
+  uint64_t w[4];
+  _load(fq_canonical(x.c0), w);
+  printf("      0x%016lx, 0x%016lx, 0x%016lx, 0x%016lx,\n", w[0], w[1], w[2], w[3]);
+}
+
+void print_fq(const FQ2 &x) {
+  print_fq(x.c0);
+  print_fq(x.c1);
+}
+
+template <typename G> void print_table(const char *name, const G &base) {
+  static FixedBaseTable<G> t(base);
+  int n = sizeof(t.table[0]) / sizeof(t.table[0][0]);
+  int windows = FixedBaseTable<G>::WINDOWS;
+  printf("constexpr uint64_t %s[%d][%d][%d] = {\n", name, windows, n, int(sizeof(t.table[0][0]) / 8));
+  for (int i = 0; i < windows; i++) {
+    printf("  {\n");
+    for (int d = 0; d < n; d++) {
+      printf("    {\n");
+      print_fq(t.table[i][d].x);
+      print_fq(t.table[i][d].y);
+      printf("    },\n");
+    }
+    printf("  },\n");
+  }
+  printf("};\n");
+}
+
+int main() {
+  printf("// Generated by script/gen_tables.sh, do not edit.\n");
+  printf("//\n");
+  printf("// The points of FixedBaseTable<G1>(G1_ONE) and FixedBaseTable<G2>(G2_ONE) in Montgomery form, x then y,\n");
+  printf("// with four 64-bit limbs per FQ from the lowest.\n");
+  printf("#ifndef BN128_MONT_TABLES_H_\n");
+  printf("#define BN128_MONT_TABLES_H_\n\n");
+  printf("#include <cstdint>\n\n");
+  printf("namespace bn128 {\n\n");
+  printf("// clang-format off\n");
+  print_table("G1_ONE_TABLE_LIMBS", G1_ONE);
+  printf("\n");
+  print_table("G2_ONE_TABLE_LIMBS", G2_ONE);
+  printf("// clang-format on\n\n");
+  printf("} // namespace bn128\n\n");
+  printf("#endif /* BN128_MONT_TABLES_H_ */\n");
+  return 0;
+}
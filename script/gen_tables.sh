@@ -0,0 +1,8 @@
+set -ex
+
+GPP=g++
+
+mkdir -p build
+
+$GPP -fno-exceptions -Os -Iinclude -Iintx/include -o build/gen_tables script/gen_tables.cpp
+./build/gen_tables > include/bn128_mont_tables.hpp
@@ -1,8 +1,42 @@
 #include <bn128_mont.hpp>
 #include <intx/intx.hpp>
+#ifndef __riscv
+#include <chrono>
+#include <cstdio>
+#endif
 
 using namespace bn128;
 
+int check(const G2 &c) {
+  G2Affine d = c.affine();
+  if (mont_decode(d.x.c0.c0) != h256("0x23997083c2c4409869ee3546806a544c8c16bc46cc88598c4e1c853eb81d45b0")) {
+    return 1;
+  }
+  if (mont_decode(d.x.c1.c0) != h256("0x1142585a23028cbe57783f890d1a2f6837049fce43c9b3b5e8e14c40a43c617a")) {
+    return 1;
+  }
+  if (mont_decode(d.y.c0.c0) != h256("0x215a23c8a96e1ca11d52cf6e2d6ada4ed01ee7e09b06dbc7f3315e7e6e73b919")) {
+    return 1;
+  }
+  if (mont_decode(d.y.c1.c0) != h256("0x0edac9f3a977530e28d4a385e614bcb7a8f9c3c3cb65707c1b90b5ea86174512")) {
+    return 1;
+  }
+  return 0;
+}
+
+#ifndef __riscv
+// Average time of f over 1000 runs.
+template <typename F> long long time_ns(F f) {
+  G2 r = G2_ZERO;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < 1000; i++) {
+    r = r + f();
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  return r.is_zero() ? 0 : std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / 1000;
+}
+#endif
+
 int main() {
   // Taking from
   // https://github.com/xxuejie/benchmarking-wasm-ewasm-evm/blob/checkpoint/evmrace/ckbvm/bn256g2_test.cpp
@@ -13,24 +47,22 @@ int main() {
             FQ(mont_encode(h256("0x090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b")))),
   };
   G2 b = a.into();
-  G2 c = b.mul(0x2dddefa19);
-  if (c.x.c0 != FQ(h256("0x1dafb20da22cc10ef4736831e8a0f1419a9753c43d8400f2949cb68a2d381719"))) {
-    return 1;
-  }
-  if (c.x.c1 != FQ(h256("0x047d62b471a91cfa91fb08d4344792a0355cc0471784adb20e9a99bf11286133"))) {
-    return 1;
-  }
-  if (c.y.c0 != FQ(h256("0x1b5694e95d08d04325f5ebb31dd1889a402e9e76de68700071cd0506326f8ec3"))) {
-    return 1;
-  }
-  if (c.y.c1 != FQ(h256("0x19c7a2f5e6eedf85ec5adff3e0c2028a52b78e15a2e081513a5e5c6309cf7cc2"))) {
-    return 1;
-  }
-  if (c.z.c0 != FQ(h256("0x1415a498e2d14c0157076be278709572d52e168d72ac62082e53aac308d50cbe"))) {
+  if (check(b.mul(0x2dddefa19)) || check(b.mul_subgroup(0x2dddefa19))) {
     return 1;
   }
-  if (c.z.c1 != FQ(h256("0x1363bae5bce3ce99dbcc3a7419295dcb54434a925f3933a7342aa8d9077925a3"))) {
+#ifndef __riscv
+  // Native timings of the generic path and of the GLS path for points of G2, with the scalar above and a full width
+  // one. In CKB-VM the cycles of the whole run are reported instead.
+  uint256 k = h256("0x2c1aa3c13cf206dd8e756e7a426504343c756ca4e891dd1a5b6124a4b95118ca");
+  G2Affine x = b.mul(k).affine();
+  G2Affine y = b.mul_subgroup(k).affine();
+  if (x.x != y.x || x.y != y.y) {
     return 1;
   }
+  printf("G2::mul(0x2dddefa19)          %lld ns\n", time_ns([&] { return b.mul(0x2dddefa19); }));
+  printf("G2::mul_subgroup(0x2dddefa19) %lld ns\n", time_ns([&] { return b.mul_subgroup(0x2dddefa19); }));
+  printf("G2::mul(254 bits)             %lld ns\n", time_ns([&] { return b.mul(k); }));
+  printf("G2::mul_subgroup(254 bits)    %lld ns\n", time_ns([&] { return b.mul_subgroup(k); }));
+#endif
   return 0;
 }
@@ -29,6 +29,111 @@ int test_powmod() {
   if (r != 1024) {
     return 1;
   }
+  if (_powmod(3, FIELD_MODULUS - 1, FIELD_MODULUS) != 1) {
+    return 1;
+  }
+  return 0;
+}
+
+int test_fq_pow() {
+  FQ a = FQ(mont_encode(h256("0x2e67157159e5c639cf63e9cfb74492d9eb2022850278edf8ed84884a014afa37")));
+  FQ b = FQ_ONE;
+  for (int i = 0; i < 40; i++) {
+    if (a.pow(i) != b) {
+      return 1;
+    }
+    b = b * a;
+  }
+  if (a.pow(FIELD_MODULUS - 1) != FQ_ONE || a.pow(FQ_CHAIN_INV) != a.inv()) {
+    return 1;
+  }
+  // FIELD_MODULUS % 4 == 3, so -1 is not a square.
+  if (FQ_NON_RESIDUE.pow(FQ_CHAIN_LEGENDRE) != -FQ_ONE || a.squared().pow(FQ_CHAIN_LEGENDRE) != FQ_ONE) {
+    return 1;
+  }
+  if (mont_decode(FQ(mont_encode(3)).pow(100).c0) != _powmod(3, 100, FIELD_MODULUS)) {
+    return 1;
+  }
+  FQ2 c = FQ2(mont_encode(3), mont_encode(4));
+  if (c.pow(5) != c * c * c * c * c) {
+    return 1;
+  }
+  if (c.pow(h256("0x10000000000000000000001")) * c.inv() != c.pow(h256("0x10000000000000000000000"))) {
+    return 1;
+  }
+  return 0;
+}
+
+int test_mont_mul() {
+  constexpr uint256 x_case[4] = {
+      h256("0x0000000000000000000000000000000000000000000000000000000000000001"),
+      h256("0x0123456789a00000000000000000000000000000000000000000000000000001"),
+      h256("0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd46"),
+      h256("0x2e67157159e5c639cf63e9cfb74492d9eb2022850278edf8ed84884a014afa37"),
+  };
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      uint256 a = x_case[i];
+      uint256 b = x_case[j];
+      uint256 r = _mulmod(_mulmod(a, b, FIELD_MODULUS), R_PRIME, FIELD_MODULUS);
+      if (mont_mul(a, b) != r) {
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+int test_mont_sqr() {
+  constexpr uint256 x_case[4] = {
+      h256("0x0000000000000000000000000000000000000000000000000000000000000001"),
+      h256("0x0123456789a00000000000000000000000000000000000000000000000000001"),
+      h256("0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd46"),
+      h256("0x2e67157159e5c639cf63e9cfb74492d9eb2022850278edf8ed84884a014afa37"),
+  };
+  for (int i = 0; i < 4; i++) {
+    uint256 a = x_case[i];
+    if (mont_sqr(a) != mont_mul(a, a)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int test_mont_adx() {
+#ifdef BN128_X86_64_ADX
+  if (!USE_ADX) {
+    return 0;
+  }
+  constexpr uint256 x_case[4] = {
+      h256("0x0000000000000000000000000000000000000000000000000000000000000001"),
+      h256("0x0123456789a00000000000000000000000000000000000000000000000000001"),
+      h256("0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd46"),
+      h256("0x2e67157159e5c639cf63e9cfb74492d9eb2022850278edf8ed84884a014afa37"),
+  };
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      uint64_t a[4], b[4], r[4], t[8];
+      _load(x_case[i], a);
+      _load(x_case[j], b);
+      _mont_mul_adx<FIELD_MODULUS>(a, b, r);
+      if (_store(r) != Fq::mul(x_case[i], x_case[j])) {
+        return 1;
+      }
+      _mul_wide(a, b, t);
+      _mont_reduce_adx<FIELD_MODULUS>(t, r);
+      if (_store(r) != Fq::mul(x_case[i], x_case[j])) {
+        return 1;
+      }
+    }
+    uint64_t a[4], r[4];
+    _load(x_case[i], a);
+    _mont_sqr_adx<FIELD_MODULUS>(a, r);
+    if (_store(r) != Fq::sqr(x_case[i])) {
+      return 1;
+    }
+  }
+#endif
   return 0;
 }
 
@@ -62,6 +167,42 @@ int test_constexpr() {
   return 0;
 }
 
+int test_fp_curve_order() {
+  // The constants of the scalar field are derived the same way as the ones of the base field.
+  if (uint512(1, 0) * uint512(Fr::R_PRIME) % uint512(CURVE_ORDER) != 1) {
+    return 1;
+  }
+  if ((uint512(1, 0) - uint512(CURVE_ORDER)) * uint512(Fr::MODULUS_PRIME) % uint512(1, 0) != 1) {
+    return 1;
+  }
+  uint512 r = uint512(1, 0) % uint512(CURVE_ORDER);
+  if (uint512(Fr::R_SQUARD) != r * r % uint512(CURVE_ORDER) || uint512(Fr::ONE) != r) {
+    return 1;
+  }
+  constexpr uint256 x_case[4] = {
+      h256("0x0000000000000000000000000000000000000000000000000000000000000001"),
+      h256("0x0123456789a00000000000000000000000000000000000000000000000000001"),
+      h256("0x30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000000"),
+      h256("0x2e67157159e5c639cf63e9cfb74492d9eb2022850278edf8ed84884a014afa37"),
+  };
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      uint256 a = x_case[i];
+      uint256 b = x_case[j];
+      if (Fr::decode(Fr::mul(Fr::encode(a), Fr::encode(b))) != _mulmod(a, b, CURVE_ORDER)) {
+        return 1;
+      }
+      if (Fr::decode(Fr::sub(Fr::encode(a), Fr::encode(b))) != _submod(a, b, CURVE_ORDER)) {
+        return 1;
+      }
+    }
+    if (Fr::inv(x_case[i]) != _invmod(x_case[i], CURVE_ORDER)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
 int test_mont_encode_decode() {
   // Taking from https://github.com/paritytech/bn
   uint256 a = mont_encode(1);
@@ -100,6 +241,12 @@ int test_fq_inv() {
   if (b != FQ(h256("0x0febf04f6c8facc474bcbedb7fb2ee53ae7fb77c84b60ab08d93172ea1809a25"))) {
     return 1;
   }
+  if (a * b != FQ_ONE || a / a != FQ_ONE) {
+    return 1;
+  }
+  if (FQ_ZERO.inv() != FQ_ZERO) {
+    return 1;
+  }
   return 0;
 }
 
@@ -111,6 +258,73 @@ int test_fq_neg() {
   if (b != FQ(h256("0x276056122a3a84578decb9facfabf986f9bbd4a9fb1f7107605a07e694e0a0d9"))) {
     return 1;
   }
+  if (-FQ_ZERO != FQ_ZERO) {
+    return 1;
+  }
+  if (a + b != FQ_ZERO || b - a != -(a + a)) {
+    return 1;
+  }
+  return 0;
+}
+
+int test_fq_lazy() {
+  // ONE and ONE + P are both valid lazy values, the latter one is not canonical.
+  FQ a = FQ(FIELD_MODULUS - 1);
+  FQ b = FQ_LAZY ? FQ(Fq::ONE + FIELD_MODULUS) : FQ_ONE;
+  if (b != FQ_ONE || a * b != a || b * b != FQ_ONE || b - FQ_ONE != FQ_ZERO) {
+    return 1;
+  }
+  FQ c = a;
+  for (int i = 0; i < 16; i++) {
+    c = c * c + c - b;
+    if (c.c0 >= (FQ_LAZY ? FIELD_MODULUS + FIELD_MODULUS : FIELD_MODULUS)) {
+      return 1;
+    }
+  }
+  if (mont_decode(b.c0) != 1 || b / b != FQ_ONE) {
+    return 1;
+  }
+  return 0;
+}
+
+int test_fq_sqrt() {
+  FQ a = FQ(mont_encode(h256("0x2e67157159e5c639cf63e9cfb74492d9eb2022850278edf8ed84884a014afa37")));
+  FQ r;
+  if (!a.squared().is_square() || !a.squared().sqrt(r) || r.squared() != a.squared()) {
+    return 1;
+  }
+  // -1 is not a square, so -a^2 is not either.
+  if ((-a.squared()).is_square() || (-a.squared()).sqrt(r)) {
+    return 1;
+  }
+  for (int i = 1; i < 32; i++) {
+    FQ b = FQ(mont_encode(i));
+    if (b.is_square() != (b.pow(FQ_CHAIN_LEGENDRE) == FQ_ONE)) {
+      return 1;
+    }
+  }
+  if (!FQ_ZERO.is_square() || !FQ_ZERO.sqrt(r) || r != FQ_ZERO) {
+    return 1;
+  }
+  return 0;
+}
+
+int test_fq2_sqrt() {
+  FQ2 a[4] = {FQ2(mont_encode(3), mont_encode(4)), FQ2(mont_encode(7), FQ_ZERO), FQ2(FQ_ZERO, mont_encode(5)),
+              FQ2(mont_encode(h256("0x2e67157159e5c639cf63e9cfb74492d9eb2022850278edf8ed84884a014afa37")),
+                  mont_encode(h256("0x0123456789a00000000000000000000000000000000000000000000000000001")))};
+  for (int i = 0; i < 4; i++) {
+    FQ2 b = a[i].squared();
+    FQ2 r;
+    if (!b.is_square() || !b.sqrt(r) || r.squared() != b) {
+      return 1;
+    }
+    // FQ2_NON_RESIDUE is not a square.
+    b = b * FQ2_NON_RESIDUE;
+    if (b.is_square() || b.sqrt(r)) {
+      return 1;
+    }
+  }
   return 0;
 }
 
@@ -157,6 +371,58 @@ int test_fq2_squared() {
   return 0;
 }
 
+int test_mul_by_non_residue() {
+  FQ a = FQ(h256("0x0020b52d9fe70d08c967a97deeb9eb186da14c608196f376d63ca9589ca5970f"));
+  if (a.mul_by_non_residue() != a * FQ_NON_RESIDUE) {
+    return 1;
+  }
+  FQ2 b = FQ2(FQ(h256("0x0020b52d9fe70d08c967a97deeb9eb186da14c608196f376d63ca9589ca5970f")),
+              FQ(h256("0x2b782d1f7dda8678b0d017978b3067b74807a5d49d2a41739659c6600a8bf015")));
+  if (b.mul_by_non_residue() != b * FQ2_NON_RESIDUE) {
+    return 1;
+  }
+  if (G2_COEFF_B_X3 != G2_COEFF_B + G2_COEFF_B + G2_COEFF_B) {
+    return 1;
+  }
+  return 0;
+}
+
+int test_frobenius_map() {
+  FQ6 a = FQ6(FQ2(h256("0x1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed"),
+                  h256("0x198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2")),
+              FQ2(h256("0x12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa"),
+                  h256("0x090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b")),
+              FQ2(h256("0x047d62b471a91cfa91fb08d4344792a0355cc0471784adb20e9a99bf11286133"),
+                  h256("0x19c7a2f5e6eedf85ec5adff3e0c2028a52b78e15a2e081513a5e5c6309cf7cc2")));
+  FQ12 b = FQ12(a, a.squared());
+  // The Frobenius endomorphism is x^p.
+  if (b.frobenius_map(1) != _pow_chain(b, _window_chain(FIELD_MODULUS), FQ12_ONE)) {
+    return 1;
+  }
+  if (b.frobenius_map(0) != b || a.frobenius_map(0) != a) {
+    return 1;
+  }
+  for (uint64_t n = 0; n < 13; n++) {
+    if (b.frobenius_map(n).frobenius_map(1) != b.frobenius_map(n + 1) ||
+        a.frobenius_map(n).frobenius_map(1) != a.frobenius_map(n + 1)) {
+      return 1;
+    }
+  }
+  if (b.frobenius_map(6) != b.unitary_inverse() || a.frobenius_map(6) != a) {
+    return 1;
+  }
+  // Against the former hard coded entries.
+  FQ2 c = FQ2(mont_encode(h256("0x30644e72e131a0295e6dd9e7e0acccb0c28f069fbb966e3de4bd44e5607cfd48")), 0);
+  FQ2 d = FQ2(mont_encode(h256("0x0bc58c6611c08dab19bee0f7b5b2444ee633094575b06bcb0e1a92bc3ccbf066")),
+              mont_encode(h256("0x23d5e999e1910a12feb0f6ef0cd21d04a44a9e08737f96e55fe3ed9d730c239f")));
+  FQ2 e = FQ2(mont_encode(h256("0x19dc81cfcc82e4bbefe9608cd0acaa90894cb38dbe55d24ae86f7d391ed4a67f")),
+              mont_encode(h256("0x00abf8b60be77d7306cbeee33576139d7f03a5e397d439ec7694aa2bf4c0c101")));
+  if (frobenius_coeffs_c1(2) != c || frobenius_coeffs_c2(3) != d || frobenius_coeffs_c1_fq12(3) != e) {
+    return 1;
+  }
+  return 0;
+}
+
 int test_fq6_inv() {
   FQ6 a = FQ6(FQ2(h256("0x1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed"),
                   h256("0x198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2")),
@@ -197,6 +463,78 @@ int test_fq6_squared() {
   return 0;
 }
 
+int test_batch_inv() {
+  FQ a[4] = {FQ(mont_encode(10)), FQ_ZERO, FQ(mont_encode(42)), FQ_ONE};
+  FQ b[4];
+  FQ scratch[4];
+  for (int i = 0; i < 4; i++) {
+    b[i] = a[i].inv();
+  }
+  batch_inv(a, scratch, 4);
+  for (int i = 0; i < 4; i++) {
+    if (a[i] != b[i]) {
+      return 1;
+    }
+  }
+  FQ2 c[3] = {FQ2(10, 20), FQ2_ZERO, FQ2(mont_encode(3), mont_encode(4))};
+  FQ2 d[3];
+  FQ2 scratch2[3];
+  for (int i = 0; i < 3; i++) {
+    d[i] = c[i] == FQ2_ZERO ? FQ2_ZERO : c[i].inv();
+  }
+  batch_inv(c, scratch2, 3);
+  for (int i = 0; i < 3; i++) {
+    if (c[i] != d[i]) {
+      return 1;
+    }
+  }
+  FQ6 f = FQ6(FQ2(10, 20), FQ2(mont_encode(3), mont_encode(4)), FQ2(30, 40));
+  FQ12 e[3] = {FQ12(f, f.squared()), FQ12_ZERO, FQ12_ONE};
+  FQ12 g[3];
+  FQ12 scratch12[3];
+  for (int i = 0; i < 3; i++) {
+    g[i] = e[i] == FQ12_ZERO ? FQ12_ZERO : e[i].inv();
+  }
+  batch_inv(e, scratch12, 3);
+  for (int i = 0; i < 3; i++) {
+    if (e[i] != g[i]) {
+      return 1;
+    }
+  }
+  if (g[0] * FQ12(f, f.squared()) != FQ12_ONE) {
+    return 1;
+  }
+  return 0;
+}
+
+int test_fqx8() {
+  FQ a[8], b[8], c[8];
+  for (int i = 0; i < 8; i++) {
+    a[i] = FQ(mont_encode(h256("0x2e67157159e5c639cf63e9cfb74492d9eb2022850278edf8ed84884a014afa37") + i));
+    b[i] = FQ(mont_encode(FIELD_MODULUS - 1 - i));
+  }
+  FQx8 x(a), y(b);
+  (x * y).into(c);
+  for (int i = 0; i < 8; i++) {
+    if (c[i] != a[i] * b[i]) {
+      return 1;
+    }
+  }
+  (x + y).into(c);
+  for (int i = 0; i < 8; i++) {
+    if (c[i] != a[i] + b[i]) {
+      return 1;
+    }
+  }
+  (x - y).into(c);
+  for (int i = 0; i < 8; i++) {
+    if (c[i] != a[i] - b[i]) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
 int test_g2_jacobian_affine_conv() {
   FQ a00 = FQ(mont_encode(h256("0x1ecfd2dff2aad18798b64bdb0c2b50c9d73e6c05619e04cbf5b448fd98726880")));
   FQ a01 = FQ(mont_encode(h256("0x0e16c8d96362720af0916592be1b839a26f5e6b710f3ede0d8840d9a70eaf97f")));
@@ -323,38 +661,334 @@ int test_g2_mul() {
   };
   G2 b = a.into();
   G2 c = b.mul(0x2dddefa19);
-  if (c.x.c0 != FQ(h256("0x1dafb20da22cc10ef4736831e8a0f1419a9753c43d8400f2949cb68a2d381719"))) {
+  G2Affine d = c.affine();
+  if (mont_decode(d.x.c0.c0) != h256("0x23997083c2c4409869ee3546806a544c8c16bc46cc88598c4e1c853eb81d45b0")) {
     return 1;
   }
-  if (c.x.c1 != FQ(h256("0x047d62b471a91cfa91fb08d4344792a0355cc0471784adb20e9a99bf11286133"))) {
+  if (mont_decode(d.x.c1.c0) != h256("0x1142585a23028cbe57783f890d1a2f6837049fce43c9b3b5e8e14c40a43c617a")) {
     return 1;
   }
-  if (c.y.c0 != FQ(h256("0x1b5694e95d08d04325f5ebb31dd1889a402e9e76de68700071cd0506326f8ec3"))) {
+  if (mont_decode(d.y.c0.c0) != h256("0x215a23c8a96e1ca11d52cf6e2d6ada4ed01ee7e09b06dbc7f3315e7e6e73b919")) {
     return 1;
   }
-  if (c.y.c1 != FQ(h256("0x19c7a2f5e6eedf85ec5adff3e0c2028a52b78e15a2e081513a5e5c6309cf7cc2"))) {
+  if (mont_decode(d.y.c1.c0) != h256("0x0edac9f3a977530e28d4a385e614bcb7a8f9c3c3cb65707c1b90b5ea86174512")) {
     return 1;
   }
-  if (c.z.c0 != FQ(h256("0x1415a498e2d14c0157076be278709572d52e168d72ac62082e53aac308d50cbe"))) {
-    return 1;
+
+  return 0;
+}
+
+// Plain double-and-add over all 256 bits, without scalar reduction or endomorphisms. It is the reference for mul.
+template <typename G> G mul_reference(const G &p, const uint256 &c) {
+  G r = _zero_of(p);
+  for (int i = 255; i >= 0; i--) {
+    r = r.doubl2();
+    if (((c >> i) & 1) != 0) {
+      r = r + p;
+    }
   }
-  if (c.z.c1 != FQ(h256("0x1363bae5bce3ce99dbcc3a7419295dcb54434a925f3933a7342aa8d9077925a3"))) {
-    return 1;
+  return r;
+}
+
+int test_wnaf() {
+  uint256 e[5] = {1, 0x2dddefa19, CURVE_ORDER,
+                  h256("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"),
+                  h256("0x8000000000000000000000000000000000000000000000000000000000000000")};
+  for (uint256 c : e) {
+    for (int w = 2; w <= 5; w++) {
+      int8_t digit[257];
+      int len = _wnaf(c, w, digit);
+      uint256 n = 0;
+      int last = 512;
+      for (int i = len - 1; i >= 0; i--) {
+        n = n + n;
+        if (digit[i] != 0) {
+          if (digit[i] % 2 == 0 || digit[i] >= 1 << (w - 1) || digit[i] <= -(1 << (w - 1)) || last - i < w) {
+            return 1;
+          }
+          n = digit[i] > 0 ? n + uint256(digit[i]) : n - uint256(-digit[i]);
+          last = i;
+        }
+      }
+      if (n != c) {
+        return 1;
+      }
+    }
   }
-  G2Affine d = c.affine();
-  if (mont_decode(d.x.c0.c0) != h256("0x23997083c2c4409869ee3546806a544c8c16bc46cc88598c4e1c853eb81d45b0")) {
+  if (!G1_ONE.mul(CURVE_ORDER).is_zero() || !G1_ONE.mul(0).is_zero()) {
     return 1;
   }
-  if (mont_decode(d.x.c1.c0) != h256("0x1142585a23028cbe57783f890d1a2f6837049fce43c9b3b5e8e14c40a43c617a")) {
+  G1Affine a = G1_ONE.mul(CURVE_ORDER - 1).affine();
+  if (a.x != G1_ONE.x || a.y != -G1_ONE.y) {
     return 1;
   }
-  if (mont_decode(d.y.c0.c0) != h256("0x215a23c8a96e1ca11d52cf6e2d6ada4ed01ee7e09b06dbc7f3315e7e6e73b919")) {
-    return 1;
+  // Scalars of every size, for both the Jacobian and the affine tables.
+  G1 b = G1_ONE.mul(7);
+  G2 d = G2_ONE.mul(7);
+  uint256 x = h256("0x2c1aa3c13cf206dd8e756e7a426504343c756ca4e891dd1a5b6124a4b95118ca");
+  for (int bits = 1; bits <= 256; bits += 15) {
+    uint256 c = x >> (256 - bits);
+    G1Affine y = b.mul(c).affine();
+    G1Affine z = mul_reference(b, c).affine();
+    G2Affine u = d.mul(c).affine();
+    G2Affine v = mul_reference(d, c).affine();
+    if (y.x != z.x || y.y != z.y || u.x != v.x || u.y != v.y) {
+      return 1;
+    }
   }
-  if (mont_decode(d.y.c1.c0) != h256("0x0edac9f3a977530e28d4a385e614bcb7a8f9c3c3cb65707c1b90b5ea86174512")) {
+  return 0;
+}
+
+int test_signed_window() {
+  uint256 e[5] = {0, 0x2dddefa19, CURVE_ORDER - 1,
+                  h256("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"),
+                  h256("0x2c1aa3c13cf206dd8e756e7a426504343c756ca4e891dd1a5b6124a4b95118ca")};
+  for (uint256 c : e) {
+    uint256 r = _reduce_order(c);
+    if (r >= CURVE_ORDER || r != c % CURVE_ORDER) {
+      return 1;
+    }
+    uint64_t n[4];
+    _load(r, n);
+    for (int w = 2; w <= 16; w++) {
+      // Digits from the top down, with enough windows for the carry of the last one.
+      int d[128];
+      int carry = 0;
+      int windows = 254 / w + 1;
+      for (int i = 0; i < windows; i++) {
+        d[i] = _signed_window(n, i, w, carry);
+        if (d[i] > 1 << (w - 1) || d[i] < -(1 << (w - 1))) {
+          return 1;
+        }
+      }
+      uint256 m = 0;
+      for (int i = windows - 1; i >= 0; i--) {
+        m = m << w;
+        m = d[i] >= 0 ? m + uint256(d[i]) : m - uint256(-d[i]);
+      }
+      if (carry != 0 || m != r) {
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+int test_glv() {
+  G1Affine a = mul_reference(G1_ONE, G1_LAMBDA).affine();
+  if (a.x != G1_ONE.x * G1_BETA || a.y != G1_ONE.y) {
+    return 1;
+  }
+  G1 b = G1_ONE.mul(0x2dddefa19);
+  uint256 x = h256("0x2c1aa3c13cf206dd8e756e7a426504343c756ca4e891dd1a5b6124a4b95118ca");
+  for (int i = 0; i < 16; i++) {
+    x = x * 0x5851f42d4c957f2d + 0x14057b7ef767814f;
+    G1Affine y = b.mul(x).affine();
+    G1Affine z = mul_reference(b, x).affine();
+    if (y.x != z.x || y.y != z.y) {
+      return 1;
+    }
+  }
+  uint256 e[5] = {0, G1_LAMBDA, CURVE_ORDER - 1,
+                  h256("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"),
+                  h256("0x2c1aa3c13cf206dd8e756e7a426504343c756ca4e891dd1a5b6124a4b95118ca")};
+  for (uint256 c : e) {
+    uint256 k[2];
+    bool neg[2];
+    _glv_split(c, k, neg);
+    if ((k[0] >> 127) != 0 || (k[1] >> 127) != 0) {
+      return 1;
+    }
+    uint256 k0 = neg[0] ? CURVE_ORDER - k[0] : k[0];
+    uint256 k1 = neg[1] ? CURVE_ORDER - k[1] : k[1];
+    if (_addmod(k0, _mulmod(k1, G1_LAMBDA, CURVE_ORDER), CURVE_ORDER) != c % CURVE_ORDER) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int test_gls() {
+  G2Affine a = mul_reference(G2_ONE, G2_PSI_LAMBDA).affine();
+  G2Affine b = G2_ONE.affine().mul_by_q();
+  G2Affine c = mul_reference(G2_ONE, FIELD_MODULUS).affine();
+  if (a.x != b.x || a.y != b.y || c.x != b.x || c.y != b.y) {
+    return 1;
+  }
+  G2 d = G2_ONE.mul(0x2dddefa19);
+  uint256 x = h256("0x2c1aa3c13cf206dd8e756e7a426504343c756ca4e891dd1a5b6124a4b95118ca");
+  for (int i = 0; i < 16; i++) {
+    x = x * 0x5851f42d4c957f2d + 0x14057b7ef767814f;
+    G2Affine y = d.mul_subgroup(x).affine();
+    G2Affine z = mul_reference(d, x).affine();
+    if (y.x != z.x || y.y != z.y || d.mul(x).affine().x != z.x) {
+      return 1;
+    }
+  }
+  // Small scalars and their negations modulo CURVE_ORDER take the single scalar path of mul_subgroup.
+  uint256 e[8] = {0, 1, 0x2dddefa19, CURVE_ORDER - 0x2dddefa19, G2_PSI_LAMBDA, CURVE_ORDER - 1,
+                  h256("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"),
+                  h256("0x2c1aa3c13cf206dd8e756e7a426504343c756ca4e891dd1a5b6124a4b95118ca")};
+  for (uint256 c : e) {
+    G2Affine y = d.mul_subgroup(c).affine();
+    G2Affine z = mul_reference(d, c).affine();
+    if (y.x != z.x || y.y != z.y) {
+      return 1;
+    }
+    uint256 k[4];
+    bool neg[4];
+    _gls_split(c, k, neg);
+    uint256 r = 0;
+    uint256 psi = 1;
+    for (int i = 0; i < 4; i++) {
+      if ((k[i] >> 66) != 0) {
+        return 1;
+      }
+      uint256 t = _mulmod(k[i], psi, CURVE_ORDER);
+      r = neg[i] ? _submod(r, t, CURVE_ORDER) : _addmod(r, t, CURVE_ORDER);
+      psi = _mulmod(psi, G2_PSI_LAMBDA, CURVE_ORDER);
+    }
+    if (r != c % CURVE_ORDER) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int test_g2_subgroup() {
+  if (!G2_ONE.is_in_subgroup() || !G2_ONE.mul(7).is_in_subgroup() || !G2_ZERO.is_in_subgroup()) {
+    return 1;
+  }
+  // A point of the twist outside G2: the first x = i + u for which x^3 + b is a square.
+  G2Affine a = G2_ONE.affine();
+  FQ2 b = a.y.squared() - a.x.squared() * a.x;
+  G2Affine p;
+  for (uint64_t i = 0;; i++) {
+    p.x = FQ2(mont_encode(i), mont_encode(1));
+    if ((p.x.squared() * p.x + b).sqrt(p.y)) {
+      break;
+    }
+  }
+  G2 q = p.into();
+  if (q.is_in_subgroup() || mul_reference(q, CURVE_ORDER).is_zero()) {
     return 1;
   }
+  // mul does not assume the order of the point.
+  uint256 e[3] = {CURVE_ORDER, CURVE_ORDER + 1,
+                  h256("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff")};
+  for (uint256 c : e) {
+    G2Affine x = q.mul(c).affine();
+    G2Affine y = mul_reference(q, c).affine();
+    if (x.x != y.x || x.y != y.y) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int test_mixed_add() {
+  G1 a = G1_ONE.mul(5);
+  G1Affine b = G1_ONE.mul(11).affine();
+  G1Affine e[4] = {b, a.affine(), a.affine().neg(), G1Affine{x : FQ_ZERO, y : FQ_ZERO}};
+  for (G1Affine x : e) {
+    G1Affine y = (a + x).affine();
+    G1Affine z = (a + x.into()).affine();
+    if (y.x != z.x || y.y != z.y || (G1_ZERO + x).affine().x != x.x) {
+      return 1;
+    }
+  }
+  G2 c = G2_ONE.mul(5);
+  G2Affine d = G2_ONE.mul(11).affine();
+  G2Affine f[4] = {d, c.affine(), c.affine().neg(), G2Affine{x : FQ2_ZERO, y : FQ2_ZERO}};
+  for (G2Affine x : f) {
+    G2Affine y = (c + x).affine();
+    G2Affine z = (c + x.into()).affine();
+    if (y.x != z.x || y.y != z.y || (G2_ZERO + x).affine().x != x.x) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int test_batch_affine() {
+  G1 a[4] = {G1_ONE.mul(5), G1_ZERO, G1_ONE, G1_ONE.mul(11)};
+  G1Affine b[4];
+  batch_affine(a, b, 4);
+  for (int i = 0; i < 4; i++) {
+    G1Affine c = a[i].affine();
+    if (b[i].x != c.x || b[i].y != c.y) {
+      return 1;
+    }
+  }
+  G2 d[4] = {G2_ZERO, G2_ONE.mul(5), G2_ONE, G2_ZERO};
+  G2Affine e[4];
+  batch_affine(d, e, 4);
+  for (int i = 0; i < 4; i++) {
+    G2Affine f = d[i].affine();
+    if (e[i].x != f.x || e[i].y != f.y) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int test_fixed_base() {
+  static FixedBaseTable<G1, 8> a(G1_ONE.mul(7));
+  static FixedBaseTable<G2, 5> b(G2_ONE.mul(7));
+  static FixedBaseTable<G2, 2> d(G2_ONE);
+  // The embedded generator tables match the ones built at runtime.
+  static FixedBaseTable<G1> g1(G1_ONE);
+  static FixedBaseTable<G2> g2(G2_ONE);
+  for (int i = 0; i < FixedBaseTable<G1>::WINDOWS; i++) {
+    for (int j = 0; j < 8; j++) {
+      if (g1_one_table().table[i][j].x != g1.table[i][j].x || g1_one_table().table[i][j].y != g1.table[i][j].y ||
+          g2_one_table().table[i][j].x != g2.table[i][j].x || g2_one_table().table[i][j].y != g2.table[i][j].y) {
+        return 1;
+      }
+    }
+  }
+  uint256 e[6] = {0, 1, 0x2dddefa19, CURVE_ORDER - 1,
+                  h256("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"),
+                  h256("0x2c1aa3c13cf206dd8e756e7a426504343c756ca4e891dd1a5b6124a4b95118ca")};
+  for (uint256 c : e) {
+    G1Affine x = a.mul(c).affine();
+    G1Affine y = G1_ONE.mul(7).mul(c).affine();
+    if (x.x != y.x || x.y != y.y || g1_one_table().mul(c).affine().x != G1_ONE.mul(c).affine().x) {
+      return 1;
+    }
+    G2Affine z = b.mul(c).affine();
+    G2Affine w = G2_ONE.mul(7).mul(c).affine();
+    if (z.x != w.x || z.y != w.y || d.mul(c).affine().y != g2_one_table().mul(c).affine().y) {
+      return 1;
+    }
+  }
+  return 0;
+}
 
+int test_g1_msm() {
+  G1Affine p[300];
+  uint256 k[300];
+  G1 q = G1_ONE;
+  uint256 x = h256("0x2c1aa3c13cf206dd8e756e7a426504343c756ca4e891dd1a5b6124a4b95118ca");
+  for (int i = 0; i < 300; i++) {
+    p[i] = q.affine();
+    q = q.doubl2() + G1_ONE;
+    x = x * 0x5851f42d4c957f2d + 0x14057b7ef767814f;
+    k[i] = i % 7 == 0 ? 0 : i % 11 == 0 ? CURVE_ORDER - 1 : x;
+  }
+  p[3] = G1Affine{x : FQ_ZERO, y : FQ_ZERO};
+  size_t e[5] = {0, 1, 2, 33, 300};
+  for (size_t n : e) {
+    G1 r = G1_ZERO;
+    for (size_t i = 0; i < n; i++) {
+      r = r + p[i].into().mul(k[i]);
+    }
+    G1Affine a = g1_msm(p, k, n).affine();
+    G1Affine b = r.affine();
+    if (a.x != b.x || a.y != b.y) {
+      return 1;
+    }
+  }
   return 0;
 }
 
@@ -672,6 +1306,50 @@ int test_alt_bn128_mul() {
   return 0;
 }
 
+int test_naf_chain() {
+  uint64_t e[5] = {0, 1, 7, 4965661367192848881, 0xffffffffffffffff};
+  for (uint64_t c : e) {
+    NafChain naf = _naf_chain(c);
+    unsigned __int128 n = 0;
+    for (int i = naf.len - 1; i >= 0; i--) {
+      n = 2 * n + naf.digit[i];
+      if (i > 0 && naf.digit[i] != 0 && naf.digit[i - 1] != 0) {
+        return 1;
+      }
+    }
+    if (n != c) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int test_cyclotomic_compressed() {
+  FQ6 a = FQ6(FQ2(h256("0x1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed"),
+                  h256("0x198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2")),
+              FQ2(h256("0x12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa"),
+                  h256("0x090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b")),
+              FQ2(h256("0x047d62b471a91cfa91fb08d4344792a0355cc0471784adb20e9a99bf11286133"),
+                  h256("0x19c7a2f5e6eedf85ec5adff3e0c2028a52b78e15a2e081513a5e5c6309cf7cc2")));
+  // An element of the cyclotomic subgroup.
+  FQ12 b = FQ12(a, a.squared()).final_exponentiation_first_chunk();
+  FQ12Compressed x[3] = {b.compress().squared(), b.compress().squared().squared(), FQ12_ONE.compress().squared()};
+  FQ12 r[3];
+  FQ2 den[3];
+  FQ2 scratch[3];
+  batch_decompress(x, r, den, scratch, 3);
+  if (r[0] != b.cyclotomic_squared() || r[1] != b.cyclotomic_squared().cyclotomic_squared() || r[2] != FQ12_ONE) {
+    return 1;
+  }
+  uint64_t e[5] = {0, 1, 6, 4965661367192848881, 0xffffffffffffffff};
+  for (uint64_t c : e) {
+    if (b.cyclotomic_pow_compressed(c) != b.cyclotomic_pow(c)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
 int test_alt_bn128_pairing() {
   FQ a00 = FQ(mont_encode(h256("0x2276cf730cf493cd95d64677bbb75fc42db72513a4c1e387b476d056f80aa75f")));
   FQ a01 = FQ(mont_encode(h256("0x1213d2149b006137fcfb23036606f848d638d576a120ca981b5b1a5f9300b3ee")));
@@ -729,24 +1407,48 @@ int main() {
     return 1;
   if (test_powmod())
     return 1;
+  if (test_fq_pow())
+    return 1;
+  if (test_mont_mul())
+    return 1;
+  if (test_mont_sqr())
+    return 1;
+  if (test_mont_adx())
+    return 1;
   if (test_constexpr())
     return 1;
+  if (test_fp_curve_order())
+    return 1;
   if (test_mont_encode_decode())
     return 1;
   if (test_fq_inv())
     return 1;
   if (test_fq_neg())
     return 1;
+  if (test_fq_lazy())
+    return 1;
+  if (test_fq_sqrt())
+    return 1;
+  if (test_fq2_sqrt())
+    return 1;
   if (test_fq2_mul())
     return 1;
   if (test_fq2_inv())
     return 1;
   if (test_fq2_squared())
     return 1;
+  if (test_mul_by_non_residue())
+    return 1;
+  if (test_frobenius_map())
+    return 1;
   if (test_fq6_inv())
     return 1;
   if (test_fq6_squared())
     return 1;
+  if (test_batch_inv())
+    return 1;
+  if (test_fqx8())
+    return 1;
   if (test_g2_jacobian_affine_conv())
     return 1;
   if (test_g2_double())
@@ -755,10 +1457,32 @@ int main() {
     return 1;
   if (test_g2_mul())
     return 1;
+  if (test_wnaf())
+    return 1;
+  if (test_signed_window())
+    return 1;
+  if (test_glv())
+    return 1;
+  if (test_gls())
+    return 1;
+  if (test_g2_subgroup())
+    return 1;
+  if (test_mixed_add())
+    return 1;
+  if (test_batch_affine())
+    return 1;
+  if (test_fixed_base())
+    return 1;
+  if (test_g1_msm())
+    return 1;
   if (test_alt_bn128_add())
     return 1;
   if (test_alt_bn128_mul())
     return 1;
+  if (test_naf_chain())
+    return 1;
+  if (test_cyclotomic_compressed())
+    return 1;
   if (test_alt_bn128_pairing())
     return 1;
   return 0;